@@ -2478,6 +2478,14 @@ Comment out this error to acknowledge this disclaimer and allow compilation."
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+
+  /**
+   * MarlinBio: Keep settings in flash as a log of CRC-checked records, one per
+   * changed 256-byte section. M500 returns at once and the idle loop writes
+   * the records while the planner is empty. Full sectors are erased in the
+   * background. Requires FLASH_EEPROM_EMULATION on a dual-bank STM32H7.
+   */
+  //#define FLASH_EEPROM_RECORDS
 #endif
 
 // @section host
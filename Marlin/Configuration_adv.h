@@ -1149,6 +1149,9 @@
 
   //#define FT_MOTION_MENU                        // Provide a MarlinUI menu to set M493 parameters
 
+  #define FTM_STEPPER_CHANNELS                    // MarlinBio: Step Z1-Z4 and E0-E3 from their own trajectories so
+                                                  // the Z locks and the syringe of each block are honored
+
   /**
    * Advanced configuration
    */
@@ -1789,6 +1792,21 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE    0.05 // (mm) Minimum Z change before saving power-loss data
 
+    /**
+     * MarlinBio: Power-loss journal
+     * Between full snapshots append small records of the moving state (file
+     * position, XY, and each syringe's Z and E) to the open recovery file.
+     * Only the latest state is held in RAM and the idle loop writes it, so
+     * saving never stalls a move. A full journal is compacted into a new
+     * snapshot. Replaces the POWER_LOSS_MIN_Z_CHANGE and interval saves.
+     */
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_COMMANDS   4 // Capture the state every N printing moves
+      #define POWER_LOSS_JOURNAL_MS       250 // (ms) Minimum time between journal writes
+      #define POWER_LOSS_JOURNAL_RECORDS  256 // Records between full snapshots
+    #endif
+
     //#define BACKUP_POWER_SUPPLY           // Backup power / UPS to move the steppers on power-loss
     #if ENABLED(BACKUP_POWER_SUPPLY)
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
@@ -1866,6 +1884,21 @@
 
   //#define AUTO_REPORT_SD_STATUS         // Auto-report media status with 'M27 S<seconds>'
 
+  /**
+   * MarlinBio: Pre-flight scan
+   * M23 reads the selected file in the background, a few bytes per idle loop,
+   * and reports the E (and ink volume) each syringe needs, the print time,
+   * tool changes, and the print bounds. Time comes from the planner's speed,
+   * acceleration, and junction limits. The result is cached in a sidecar file
+   * (same 8.3 name, ".PFL") and feeds the time left in M27 and M73.
+   * Use M725 to report or rescan.
+   */
+  //#define PREFLIGHT_SCAN
+  #if ENABLED(PREFLIGHT_SCAN)
+    #define PREFLIGHT_SCAN_BYTES 512      // Most bytes to scan per idle loop. 64 during a media print.
+    #define PREFLIGHT_MARKS       32      // Points in the file with a known time, for the time left
+  #endif
+
   /**
    * Support for USB thumb drives using an Arduino USB Host Shield or
    * equivalent MAX3421E breakout board. The USB thumb drive will appear
@@ -2377,6 +2410,51 @@
   #endif
 #endif
 
+/**
+ * MarlinBio: Syringe Flow Model
+ *
+ * Per-tool model of a syringe extruder for viscous bio-inks. The pressure behind the needle
+ * lags the plunger with a first-order time constant, so the plunger is led by TAU * (E speed)
+ * while accelerating and pulled back while decelerating. TAU replaces the Linear Advance K of
+ * each tool and drives the FT Motion E trajectory, removing the need for dwells at path ends.
+ * TAU is measured with a needle of SYRINGE_TAU_GAUGE. The needle resistance goes with 1/bore^4,
+ * so each tool's TAU is scaled by its own needle gauge (gauge 0 uses TAU as given).
+ *
+ * In volumetric mode (M200 S1) the barrel inner diameter takes the place of the M200 filament
+ * diameter, which is kept for tools with no barrel diameter (M718 D0).
+ * Configure with M718 T D B K. Requires LIN_ADVANCE or FT_MOTION.
+ */
+//#define SYRINGE_FLOW_MODEL
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #define SYRINGE_INNER_DIAMETER { 14.5 } // (mm) Barrel inner diameter, per extruder (14.5 for a 10mL syringe)
+  #define SYRINGE_NEEDLE_GAUGE   { 22 }   // Needle gauge, per extruder (14-34, 0 for none)
+  #define SYRINGE_PRESSURE_TAU   { 0.1 }  // (s) Pressure time constant, per extruder
+  #define SYRINGE_TAU_GAUGE      22       // Needle gauge the TAU values are measured with
+
+  /**
+   * Hold the deposited volume per mm constant through junctions. The stepper keeps the syringe
+   * pressure (the advance steps) at TAU times the E rate all through each block, following the
+   * trapezoid while accelerating, cruising and decelerating. Where the E per mm changes at a
+   * junction, the pressure step is made with E-only steps on top of the motion, so extruding
+   * corners keep their full junction deviation speed.
+   * Where extrusion ends the planner slows to the minimum speed and the last extruding block
+   * releases all the pressure by its end, so none oozes on the next move. Requires LIN_ADVANCE.
+   */
+  //#define SYRINGE_CONSTANT_VOLUME
+#endif
+
+/**
+ * MarlinBio: Tool Motion Profiles
+ *
+ * Give each tool its own steps/mm, max feedrate, acceleration and jerk settings (M92, M203, M201,
+ * M204, M205) and advance K (M900, unless SYRINGE_FLOW_MODEL sets it). These commands act on the
+ * active tool. A tool change swaps in the new tool's settings along with the step rates derived
+ * from them, so no recalculation happens between moves. Name, copy, or set the profile of any
+ * tool with M726, which also reports every profile for replay.
+ * The Z offset of each tool remains the hotend offset (M218).
+ */
+//#define TOOL_MOTION_PROFILES
+
 /**
  * Nonlinear Extrusion Control
  *
@@ -2556,6 +2634,10 @@
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+  //#define ARC_NATIVE_BLOCKS         // MarlinBio: Queue each arc as a few curved blocks that FT Motion interpolates. Requires FT_MOTION.
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    #define ARC_NATIVE_MAX_SWEEP 90   // (°) Largest sweep of a single curved block
+  #endif
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
@@ -2563,6 +2645,12 @@
 
 #if ANY(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
+  #define ADAPTIVE_CURVE_SEGMENTS     // MarlinBio: Size G2/G3/G5 segments by chord tolerance and planner headroom (M719)
+  #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+    #define CURVE_CHORD_TOLERANCE 0.01 // (mm) Max deviation of a G2/G3 segment from the arc
+    #define BEZIER_CHORD_TOLERANCE 0.1 // (mm) Max deviation of a G5 segment from the curve
+    #define CURVE_SEGMENT_STRETCH  4   // Max segment length factor (x MAX_ARC_SEGMENT_MM) when the planner is nearly full
+  #endif
 #endif
 
 /**
@@ -2574,6 +2662,18 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  /**
+   * MarlinBio: Queue-step pages
+   * The SP_QS_256 page format carries only the motors a page moves: X, Y, each
+   * Z motor and each E stepper. Every motor steps from its own records of
+   * { interval, add, count }, so steady or ramping motion packs into a few bytes.
+   * With DIRECT_STEPPING_SD, M722 streams these pages from a media file instead
+   * of the serial page protocol.
+   */
+  //#define STEPPER_PAGE_FORMAT SP_QS_256
+  //#define DIRECT_STEPPING_SD
+#endif
 
 /**
  * G38 Probe Target
@@ -2593,6 +2693,28 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * MarlinBio: Merge runs of nearly collinear G0/G1 moves into one planner block.
+ * A move is held back while the planner has COALESCE_MIN_QUEUED blocks or more,
+ * and following moves are folded into it while they stay within tolerance.
+ */
+#define SEGMENT_COALESCING
+#if ENABLED(SEGMENT_COALESCING)
+  #define COALESCE_MAX_ANGLE     1.0  // (°) Max direction change from the start of the run
+  #define COALESCE_E_RATIO_TOL   0.02 // Max relative change of E per mm
+  #define COALESCE_FEEDRATE_TOL  0.02 // Max relative change of feedrate
+  #define COALESCE_MAX_LENGTH    5.0  // (mm) Longest merged move
+  #define COALESCE_MIN_QUEUED    4    // Planner blocks needed before a move is held back
+#endif
+
+/**
+ * MarlinBio: Plan E-only moves (retract, prime, plunger loading) as isolated trapezoids.
+ * They enter and leave at the E jerk speed, skipping the junction math and the lookahead
+ * pass, and the move after one starts from rest. With SEGMENT_COALESCING consecutive
+ * E-only moves for the same extruder are merged.
+ */
+#define E_ONLY_FAST_PATH
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -2657,6 +2779,51 @@
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * MarlinBio: Runtime-sized block buffer
+ * Dimension the planner block ring from a RAM budget instead of a fixed count.
+ * The pool holds the largest power-of-2 number of blocks that fits the budget
+ * and ring indices become 16-bit. The live ring starts as the whole pool.
+ * M720 can shrink it, down to BLOCK_BUFFER_SIZE, and grow it back.
+ * A longer ring gives more lookahead for paths made of very short segments,
+ * but takes longer to drain on pause / cancel, so keep the budget modest.
+ */
+#define RUNTIME_BLOCK_BUFFER
+#if ENABLED(RUNTIME_BLOCK_BUFFER)
+  #define BLOCK_BUFFER_RAM_BUDGET 8192    // (bytes) RAM reserved for planner blocks
+#endif
+
+/**
+ * MarlinBio: Compact planner blocks
+ * Split each planner block into the part the Stepper ISR reads and the part
+ * only the planner needs, kept in two arrays so the ISR walks a smaller ring.
+ * Fan speeds, mixer color and paste pressure are no longer carried by every
+ * move. They are queued as a small state record only when they change, in
+ * space that moves use for planner-only data. The ring the ISR walks shrinks
+ * by about a third, but the RAM per block only drops by the size of that
+ * state, so expect fewer than 25% more blocks for the same budget.
+ */
+#define COMPACT_PLANNER_BLOCKS
+
+/**
+ * MarlinBio: Incremental lookahead
+ * Keep a frontier behind which entry speeds can no longer change. The reverse
+ * pass stops there, and the forward pass starts at the last move the reverse
+ * pass left unchanged instead of at the tail. With a long block buffer this
+ * keeps the work per new block from growing with the number of queued blocks.
+ */
+#define INCREMENTAL_LOOKAHEAD
+//#define PLANNER_LOOKAHEAD_STATS         // Count blocks visited per new block. Report with M721, reset with M721 R.
+
+/**
+ * MarlinBio: Fixed-point trapezoid math
+ * Plan acceleration and deceleration ramps from the integer step rates with
+ * 64-bit integer math instead of float. The ramps come out exact for long,
+ * fast moves where float rounding loses steps, and planning is faster on
+ * boards without an FPU. Speeds in mm/s and the junction logic stay float.
+ */
+//#define PLANNER_FIXED_POINT
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -2752,6 +2919,14 @@
 // For serial echo, the number of digits after the decimal point
 //#define SERIAL_FLOAT_PRECISION 4
 
+/**
+ * MarlinBio: Collect the output of reports (M105, M114, M119, M122, temperature and position
+ * auto-reports) in a buffer and pass each one to the serial port as a single block, instead of
+ * one byte at a time. Reports larger than the buffer go out in buffer-sized blocks. Output
+ * collected so far is also sent when the port changes (PORT_REDIRECT) and in idle().
+ */
+//#define SERIAL_REPORT_BUFFER 256 // (bytes)
+
 /**
  * This feature is EXPERIMENTAL so use with caution and test thoroughly.
  * Enable this option to receive data on the serial ports via the onboard DMA
@@ -2834,6 +3009,12 @@
     //#define EVENT_GCODE_AFTER_TOOLCHANGE "G12X"   // Extra G-code to run after tool-change
   #endif
 
+  // MarlinBio: Queue the tool change as a planner sync block instead of waiting for the planner
+  // to empty. The stepper switches the Z locks when it reaches the block, so the moves before and
+  // after a tool change are planned and buffered without a stall.
+  // FT_MOTION requires FTM_STEPPER_CHANNELS, which apply the Z locks in step order.
+  #define TOOLCHANGE_SYNC_BLOCK
+
   /**
    * Extra G-code to run while executing tool-change commands. Can be used to use an additional
    * stepper motor (e.g., I axis in Configuration.h) to drive the tool-changer.
@@ -3496,6 +3677,22 @@
     #define IMPROVE_HOMING_RELIABILITY
   #endif
 
+  /**
+   * MarlinBio: Syringe plunger auto-zero with M717.
+   * Drive the plungers of all loaded syringes forward together. Each one stops
+   * when its E driver reports a StallGuard stall against the piston, then backs
+   * off by the preload and the E position is zeroed.
+   * The E drivers have no DIAG endstop lines, so the load is read over UART.
+   */
+  #define SYRINGE_AUTO_ZERO
+  #if ENABLED(SYRINGE_AUTO_ZERO)
+    #define SYRINGE_ZERO_FEEDRATE             2 // (mm/s) Plunger approach speed
+    #define SYRINGE_ZERO_PRELOAD_MM         0.1 // (mm) Back-off after contact
+    #define SYRINGE_ZERO_MAX_TRAVEL          60 // (mm) Give up if no contact within this distance
+    #define SYRINGE_ZERO_STALL_SENSITIVITY  100 // TMC2209: 0...255
+    #define SYRINGE_ZERO_GUARD_MS           300 // (ms) Ignore stall readings while the plungers start moving
+  #endif
+
   // @section tmc/config
 
   /**
@@ -3617,6 +3814,18 @@
   #ifdef PHOTO_PULSES_US
     #define PHOTO_PULSE_DELAY_US 13 // (µs) Approximate duration of each HIGH and LOW pulse in the oscillation
   #endif
+
+  /**
+   * MarlinBio: Capture in step with motion
+   * M240 Q queues the CHDK_PIN trigger with the moves instead of parking and
+   * waiting, and M724 schedules captures every N mm of printed path or at
+   * each new layer. The host gets the stepper position of every trigger.
+   * Requires OUTPUT_EVENT_BLOCKS, CHDK_PIN, and PHOTO_SWITCH_MS.
+   */
+  //#define CAMERA_CAPTURE_SCHEDULER
+  #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+    #define CAMERA_CAPTURE_STAMPS 8 // Trigger stamps held until the main loop reports them
+  #endif
 #endif
 
 // @section cnc
@@ -3826,6 +4035,22 @@
   #define COOLANT_FLOOD_INVERT false  // Set "true" if the on/off function is reversed
 #endif
 
+/**
+ * MarlinBio: UV exposure head
+ * Cure photocrosslinkable bioinks with UV LEDs as they leave the nozzle.
+ * Like inline laser power, each channel's power follows the head speed
+ * through acceleration and deceleration so every mm of strand gets the
+ * same dose. Only extruding moves are exposed. Use M723 to set the dose.
+ */
+//#define UV_EXPOSURE_HEAD
+#if ENABLED(UV_EXPOSURE_HEAD)
+  #define UV_EXPOSURE_CHANNELS  2           // Number of independently driven LED rings
+  #define UV_EXPOSURE_PINS      { PA8, PB0 } // PWM pin of each channel
+  #define UV_EXPOSURE_DOSE      { 8, 8 }    // (PWM counts per mm/s) Default dose of each channel
+  //#define UV_EXPOSURE_PWM_FREQ 20000      // (Hz) LED driver PWM frequency, if the HAL supports it
+  //#define UV_EXPOSURE_INVERT              // LED drivers are on when the pin is LOW
+#endif
+
 // @section filament width
 
 /**
@@ -4204,6 +4429,19 @@
 //#define CANCEL_OBJECTS
 #if ENABLED(CANCEL_OBJECTS)
   #define CANCEL_OBJECTS_REPORTING // Emit the current object as a status message
+
+  /**
+   * MarlinBio: Seek past canceled objects in SD prints
+   * When the SD reader meets "M486 S<n>" for a canceled object it scans the
+   * file for the end of the object's moves and jumps there, so they are never
+   * queued or parsed. The final position, E, and feedrate are handed on with
+   * M486 X Y Z E F, which moves to the position the object ended at.
+   * Any other command in the object stops the scan and runs as usual.
+   */
+  //#define CANCEL_OBJECTS_SEEK
+  #if ENABLED(CANCEL_OBJECTS_SEEK)
+    #define CANCEL_OBJECTS_SEEK_BYTES 4096 // Most bytes to scan per call, to keep the main loop responsive
+  #endif
 #endif
 
 /**
@@ -4663,6 +4901,17 @@
 //
 //#define DIRECT_PIN_CONTROL
 
+/**
+ * MarlinBio: Output event blocks
+ * Carry pin changes through the planner so they happen in step with motion
+ * without waiting for the planner to empty. The Stepper ISR applies each
+ * change at a block boundary, or partway through a move with M42 Q D<mm>.
+ * Only XYZ travel counts toward D. A change whose travel never comes applies
+ * at the next position or tool sync, or when the queue drains.
+ * M7/M8/M9 queue their coolant pin changes the same way.
+ */
+#define OUTPUT_EVENT_BLOCKS
+
 //
 // M43 - display pin status, toggle pins, watch pins, watch endstops & toggle LED, test servo probe
 //
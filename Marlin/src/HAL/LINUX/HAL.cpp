@@ -30,6 +30,12 @@
 // ------------------------
 
 MSerialT usb_serial(TERN0(EMERGENCY_PARSER, true));
+#ifdef SERIAL_PORT_2
+  MSerialT serial_port_2(TERN0(EMERGENCY_PARSER, true), false);
+#endif
+#ifdef SERIAL_PORT_3
+  MSerialT serial_port_3(TERN0(EMERGENCY_PARSER, true), false);
+#endif
 
 // U8glib required functions
 extern "C" {
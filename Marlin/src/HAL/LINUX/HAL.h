@@ -78,6 +78,16 @@ uint8_t _getc();
 extern MSerialT usb_serial;
 #define MYSERIAL1 usb_serial
 
+// More ports start disconnected. Attach them with --serial2=... and --serial3=...
+#ifdef SERIAL_PORT_2
+  extern MSerialT serial_port_2;
+  #define MYSERIAL2 serial_port_2
+#endif
+#ifdef SERIAL_PORT_3
+  extern MSerialT serial_port_3;
+  #define MYSERIAL3 serial_port_3
+#endif
+
 //
 // Interrupts
 //
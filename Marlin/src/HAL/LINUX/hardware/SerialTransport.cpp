@@ -0,0 +1,173 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "SerialTransport.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// Most bytes moved by one system call
+#define TRANSPORT_BLOCK_SIZE 1024
+
+bool SerialTransport::begin(const char * const spec) {
+  bool ok = false;
+  if (!strcmp(spec, "stdio")) {
+    kind = STDIO;
+    in_fd = STDIN_FILENO;
+    out_fd = STDOUT_FILENO;
+    input_open = port.host_connected = true;
+    ok = true;
+  }
+  else if (!strncmp(spec, "tcp:", 4)) {
+    kind = TCP;
+    // tcp:<port> or tcp:<ip>:<port>
+    const char * const addr = spec + 4, * const colon = strrchr(addr, ':');
+    char ip[INET_ADDRSTRLEN] = "";
+    if (colon && size_t(colon - addr) < sizeof(ip)) memcpy(ip, addr, colon - addr);
+    const int tcp_port = atoi(colon ? colon + 1 : addr);
+    ok = WITHIN(tcp_port, 1, 65535) && (!colon || ip[0]) && listen_tcp(colon ? ip : nullptr, tcp_port);
+  }
+  else if (!strncmp(spec, "unix:", 5)) {
+    kind = UNIX_SOCKET;
+    ok = spec[5] && listen_unix(spec + 5);
+  }
+
+  if (!ok) return false;
+
+  // A socket has no host until one connects, so writes don't wait on it
+  if (kind != STDIO) port.host_connected = false;
+  thread = std::thread(&SerialTransport::run, this);
+  return true;
+}
+
+bool SerialTransport::listen_tcp(const char * const ip, const uint16_t tcp_port) {
+  // Only local hosts can connect unless an address is given
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(tcp_port);
+  if (ip && inet_pton(AF_INET, ip, &addr.sin_addr) != 1) return false;
+
+  listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd < 0) return false;
+
+  const int one = 1;
+  setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) || listen(listen_fd, 1)) {
+    perror("tcp");
+    close(listen_fd);
+    return false;
+  }
+  return true;
+}
+
+bool SerialTransport::listen_unix(const char * const path) {
+  sockaddr_un addr = {};
+  if (strlen(path) >= sizeof(addr.sun_path)) return false;
+
+  listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd < 0) return false;
+
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+  unlink(path); // Left over from an earlier run
+  if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) || listen(listen_fd, 1)) {
+    perror("unix");
+    close(listen_fd);
+    return false;
+  }
+  return true;
+}
+
+void SerialTransport::run() {
+  for (;;) {
+    if (kind != STDIO && in_fd < 0) {
+      // Wait for a host to connect
+      const int fd = accept(listen_fd, nullptr, nullptr);
+      if (fd < 0) continue;
+      if (kind == TCP) {
+        const int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      }
+      in_fd = out_fd = fd;
+      // Drop output written before the host connected
+      uint8_t discard[TRANSPORT_BLOCK_SIZE];
+      while (port.transmit_buffer.read(discard, sizeof(discard))) { /* nada */ }
+      input_open = port.host_connected = true;
+    }
+    if (!pump()) hang_up();
+  }
+}
+
+// Move one block of input and all waiting output. Return false when the host has gone.
+bool SerialTransport::pump() {
+  uint8_t block[TRANSPORT_BLOCK_SIZE];
+
+  // Read only what the port can hold, leaving the rest for the socket to hold back
+  const uint32_t room = _MIN(port.receive_buffer.free(), uint32_t(sizeof(block)));
+  if (room && input_open) {
+    // A short wait for input keeps the output prompt
+    pollfd pfd = { in_fd, POLLIN, 0 };
+    if (poll(&pfd, 1, 1) > 0) {
+      const ssize_t n = read(in_fd, block, room);
+      if (n > 0)
+        port.receive_buffer.write(block, uint32_t(n));
+      else if (n == 0 || errno != EINTR) {
+        if (kind != STDIO) return false;
+        input_open = false; // End of input. Keep the output going.
+      }
+    }
+  }
+  else
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  while (const uint32_t n = port.transmit_buffer.read(block, sizeof(block))) {
+    for (uint32_t sent = 0; sent < n;) {
+      const ssize_t w = kind == STDIO ? write(out_fd, block + sent, n - sent)
+                                      : send(out_fd, block + sent, n - sent, MSG_NOSIGNAL);
+      if (w > 0) sent += w;
+      else if (errno != EINTR) return false;
+    }
+  }
+  return true;
+}
+
+void SerialTransport::hang_up() {
+  input_open = port.host_connected = false;
+  // A partial line from this host must not run into the next host's input
+  port.drop_received();
+  if (kind == STDIO) return;
+  close(in_fd);
+  in_fd = out_fd = -1;
+}
+
+#endif // __PLAT_LINUX__
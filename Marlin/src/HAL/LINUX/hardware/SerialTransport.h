@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Connect a simulated serial port to the outside world.
+ *
+ *   stdio           : The console (the default for the first port)
+ *   tcp:<port>      : Listen on a TCP port of the loopback address, one host at a time
+ *   tcp:<ip>:<port> : Listen on a TCP port of the given IPv4 address (0.0.0.0 for all)
+ *   unix:<path>     : Listen on a Unix domain socket
+ *
+ * Each transport runs in its own thread, moving data between the socket and
+ * the port's ring buffers in blocks. A port reports itself connected only while
+ * a host is attached, so nothing piles up for an absent host. Input left over
+ * from a host that went away is dropped.
+ */
+
+#include "../include/serial.h"
+
+#include <thread>
+
+class SerialTransport {
+public:
+  SerialTransport(HalSerial &port) : port(port) {}
+
+  // Parse a transport spec and start serving the port. Return false for a bad spec.
+  bool begin(const char * const spec);
+
+private:
+  enum Kind : uint8_t { STDIO, TCP, UNIX_SOCKET };
+
+  HalSerial &port;
+  Kind kind = STDIO;
+  int listen_fd = -1, in_fd = -1, out_fd = -1;
+  bool input_open = false;
+  std::thread thread;
+
+  bool listen_tcp(const char * const ip, const uint16_t tcp_port);
+  bool listen_unix(const char * const path);
+  void run();
+  bool pump();
+  void hang_up();
+};
@@ -62,6 +62,30 @@ public:
     return true;
   }
 
+  // Copy out as many values as are available, up to n, publishing the new index once
+  uint32_t read(T *values, uint32_t n) volatile {
+    n = _MIN(n, available());
+    for (uint32_t i = 0; i < n; i++) values[i] = buffer[mask(index_read + i)];
+    index_read += n;
+    return n;
+  }
+
+  // Producer: The position after the last value written
+  uint32_t write_position() volatile { return index_write; }
+
+  // Consumer: Drop the values written before the given write position
+  void skip_to(const uint32_t position) volatile {
+    if (position - index_read <= buffer_size) index_read = position;
+  }
+
+  // Copy in as many values as will fit, up to n, publishing the new index once
+  uint32_t write(const T *values, uint32_t n) volatile {
+    n = _MIN(n, free());
+    for (uint32_t i = 0; i < n; i++) buffer[mask(index_write + i)] = values[i];
+    index_write += n;
+    return n;
+  }
+
 private:
   uint32_t mask(uint32_t val) volatile {
     return buffer_mask & val;
@@ -74,31 +98,53 @@ private:
   volatile uint32_t index_read;
 };
 
+// Large enough to carry a busy host's stream without stalling either side
+#ifndef LINUX_SERIAL_BUFFER_SIZE
+  #define LINUX_SERIAL_BUFFER_SIZE 4096
+#endif
+
 struct HalSerial {
-  HalSerial() { host_connected = true; }
+  HalSerial(const bool connected=true) { host_connected = connected; }
 
   void begin(int32_t) {}
   void end()          {}
 
   int peek() {
+    skip_dropped();
     uint8_t value;
     return receive_buffer.peek(&value) ? value : -1;
   }
 
-  int read() { return receive_buffer.read(); }
+  int read() { skip_dropped(); return receive_buffer.read(); }
 
   size_t write(char c) {
-    if (!host_connected) return 0;
-    while (!transmit_buffer.free());
-    return transmit_buffer.write(c);
+    // Wait for room, unless the host goes away meanwhile
+    while (!transmit_buffer.free()) if (!host_connected) return 0;
+    return host_connected && transmit_buffer.write(c);
+  }
+
+  // Copy a whole block into the transmit buffer as fast as the transport drains it
+  size_t write(const uint8_t *buffer, size_t size) {
+    size_t sent = 0;
+    while (sent < size && host_connected)
+      sent += transmit_buffer.write(buffer + sent, uint32_t(size - sent));
+    return sent;
   }
 
   bool connected() { return host_connected; }
 
   uint16_t available() {
+    skip_dropped();
     return (uint16_t)receive_buffer.available();
   }
 
+  // Transport thread: Drop the input received so far, as when the host goes away.
+  // The reading side does the skip, since it owns the read index.
+  void drop_received() {
+    drop_position = receive_buffer.write_position();
+    drop_pending = true;
+  }
+
   void flush() { receive_buffer.clear(); }
 
   uint8_t availableForWrite() {
@@ -106,13 +152,22 @@ struct HalSerial {
   }
 
   void flushTX() {
-    if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+    while (host_connected && transmit_buffer.available()) { /* nada */ }
   }
 
-  volatile RingBuffer<uint8_t, 128> receive_buffer;
-  volatile RingBuffer<uint8_t, 128> transmit_buffer;
+  volatile RingBuffer<uint8_t, LINUX_SERIAL_BUFFER_SIZE> receive_buffer;
+  volatile RingBuffer<uint8_t, LINUX_SERIAL_BUFFER_SIZE> transmit_buffer;
   volatile bool host_connected;
+
+private:
+  volatile bool drop_pending = false;
+  volatile uint32_t drop_position;
+
+  void skip_dropped() {
+    if (!drop_pending) return;
+    drop_pending = false;
+    receive_buffer.skip_to(drop_position);
+  }
 };
 
 typedef Serial1Class<HalSerial> MSerialT;
@@ -30,6 +30,7 @@
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/SerialTransport.h"
 
 #include <stdio.h>
 #include <stdarg.h>
@@ -40,25 +41,48 @@
 extern void setup();
 extern void loop();
 
-// simple stdout / stdin implementation for fake serial port
-void write_serial_thread() {
-  for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+// Serial ports that can be attached to a transport with --serialN=<spec>
+HalSerial * const serial_ports[] = {
+  &MYSERIAL1
+  #ifdef MYSERIAL2
+    , &MYSERIAL2
+  #endif
+  #ifdef MYSERIAL3
+    , &MYSERIAL3
+  #endif
+};
+
+/**
+ * Attach the serial ports. The first port uses the console unless told otherwise.
+ *
+ *   --serial1=stdio
+ *   --serial2=tcp:8250            (loopback only)
+ *   --serial2=tcp:0.0.0.0:8250    (all interfaces)
+ *   --serial3=unix:/tmp/marlin.sock
+ */
+bool start_serial_transports(int argc, char *argv[]) {
+  const char *spec[COUNT(serial_ports)] = { "stdio" };
+  for (int i = 1; i < argc; i++) {
+    unsigned n = 0;
+    int len = 0;
+    if (sscanf(argv[i], "--serial%u=%n", &n, &len) == 1 && len && WITHIN(n, 1U, COUNT(serial_ports)))
+      spec[n - 1] = argv[i] + len;
+    else {
+      fprintf(stderr, "Unknown option: %s\n", argv[i]);
+      return false;
     }
-    std::this_thread::yield();
   }
-}
 
-void read_serial_thread() {
-  char buffer[255] = {};
-  for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
-    std::this_thread::yield();
+  static SerialTransport *transport[COUNT(serial_ports)];
+  for (uint8_t i = 0; i < COUNT(serial_ports); i++) {
+    if (!spec[i]) continue;
+    transport[i] = new SerialTransport(*serial_ports[i]);
+    if (!transport[i]->begin(spec[i])) {
+      fprintf(stderr, "Can't attach serial port %d to %s\n", i + 1, spec[i]);
+      return false;
+    }
   }
+  return true;
 }
 
 void simulation_loop() {
@@ -106,9 +130,8 @@ void simulation_loop() {
   }
 }
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+int main(int argc, char *argv[]) {
+  if (!start_serial_transports(argc, argv)) return 1;
 
   #ifdef MYSERIAL1
     MYSERIAL1.begin(BAUDRATE);
@@ -132,8 +155,6 @@ int main() {
   }
 
   simulation.join();
-  write_serial.join();
-  read_serial.join();
 }
 
 #endif // UNIT_TEST
@@ -203,4 +203,10 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  /**
+   * Create the timer for a PWM pin, at the default frequency if it has none,
+   * so set_pwm_duty() can be called from an ISR without allocating memory.
+   */
+  static void init_pwm_timer(const pin_t pin);
+
 };
@@ -391,6 +391,40 @@ size_t HAL_HardwareSerial::write(uint8_t c) {             // Interrupt based wri
   return 1;
 }
 
+// Copy a block into the ring in as few pieces as possible, then start sending
+size_t HAL_HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  const size_t total = size;
+  while (size) {
+    const tx_buffer_index_t head = _serial.tx_head;
+    // Free space up to the end of the ring, keeping one slot open to tell full from empty
+    size_t room = (TX_BUFFER_SIZE + _serial.tx_tail - head - 1) % TX_BUFFER_SIZE;
+    NOMORE(room, size_t(TX_BUFFER_SIZE - head));
+    if (!room) {
+      start_tx(); // Let the interrupt free up space
+      continue;
+    }
+    NOMORE(room, size);
+    memcpy(&_serial.tx_buff[head], buffer, room);
+    _serial.tx_head = (head + room) % TX_BUFFER_SIZE;
+    buffer += room;
+    size -= room;
+  }
+  start_tx();
+  return total;
+}
+
+// Start the transmit interrupt if it's idle and there's something to send
+void HAL_HardwareSerial::start_tx() {
+  if (serial_tx_active(&_serial) || _serial.tx_head == _serial.tx_tail) return;
+  #ifdef STM32H7xx // Support STM32H7xx with different uart_attach_tx_callback
+    const size_t remaining_data = (TX_BUFFER_SIZE + _serial.tx_head - _serial.tx_tail) % TX_BUFFER_SIZE;
+    _serial.tx_size = min(remaining_data, (size_t)(TX_BUFFER_SIZE - _serial.tx_tail));
+    uart_attach_tx_callback(&_serial, _tx_complete_irq, _serial.tx_size);
+  #else
+    uart_attach_tx_callback(&_serial, _tx_complete_irq);
+  #endif
+}
+
 void HAL_HardwareSerial::flush() {
   while ((_serial.tx_head != _serial.tx_tail)) { /* nada */ } // nop, the interrupt handler will free up space for us
 }
@@ -63,6 +63,7 @@ class HAL_HardwareSerial : public Stream {
     virtual int read();
     virtual int peek();
     virtual size_t write(uint8_t);
+    virtual size_t write(const uint8_t *buffer, size_t size);
     virtual void flush();
     operator bool() { return true; }
 
@@ -77,6 +78,7 @@ class HAL_HardwareSerial : public Stream {
     uint8_t _config;
     unsigned long _baud;
     void init(PinName _rx, PinName _tx);
+    void start_tx();
     void update_rx_head();
     DMA_CFG RX_DMA;
     void Serial_DMA_Read_Enable();
@@ -25,7 +25,7 @@
 
 #include "../../../inc/MarlinConfig.h"
 
-#if ENABLED(FLASH_EEPROM_EMULATION)
+#if ENABLED(FLASH_EEPROM_EMULATION) && DISABLED(FLASH_EEPROM_RECORDS)
 
 #include "../../shared/eeprom_api.h"
 
@@ -299,5 +299,5 @@ bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t
   return false;
 }
 
-#endif // FLASH_EEPROM_EMULATION
+#endif // FLASH_EEPROM_EMULATION && !FLASH_EEPROM_RECORDS
 #endif // HAL_STM32
@@ -0,0 +1,274 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_EEPROM_RECORDS)
+
+#include "../../shared/eeprom_api.h"
+#include "../../shared/flash_records.h"
+
+#include <stm32_def.h>
+
+#define DEBUG_OUT ENABLED(EEPROM_CHITCHAT)
+#include "../../../core/debug_out.h"
+
+/**
+ * Settings kept as a log of records in two flash sectors
+ *
+ * The EEPROM image lives in RAM, split into sections. Saving marks the
+ * changed sections and the idle loop appends one record per section:
+ * { header, data } with the data CRC, the section key, and a save number.
+ * The last record of a save is flagged, so a save interrupted by a reset
+ * is ignored as a whole. At boot the log is read back to front, taking
+ * only the newest committed record of each section.
+ *
+ * When a sector fills, the whole image is written to the other (erased)
+ * sector and the full one is erased in the background. Records go to the
+ * second flash bank so programming and erasing never stall the code, which
+ * runs from the first. Single-bank parts are rejected by the sanity check.
+ */
+
+#ifndef MARLIN_EEPROM_SIZE
+  #define MARLIN_EEPROM_SIZE    0x1000 // 4KB
+#endif
+#ifndef FLASH_RECORDS_SECTOR
+  #define FLASH_RECORDS_SECTOR  (FLASH_SECTOR_TOTAL - 2) // This sector and the next
+#endif
+
+#define FLASH_RECORDS_BANK      FLASH_BANK_2
+#define FLASH_RECORDS_BASE      FLASH_BANK2_BASE
+
+#define FLASHWORD_SIZE          32U     // STM32H7xx a FLASHWORD is 32 bytes (256 bits)
+#define FLASH_FLAGS_TO_CLEAR    (FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGSERR)
+
+#define SECTION_SIZE            FLASH_RECORD_SECTION
+#define SECTIONS                ((MARLIN_EEPROM_SIZE) / (SECTION_SIZE))
+#define ALL_SECTIONS            uint32_t((SECTIONS) < 32 ? _BV32(SECTIONS) - 1 : 0xFFFFFFFFUL)
+#define RECORD_SIZE             (FLASH_RECORD_HEADER + (SECTION_SIZE))
+#define RECORD_SLOTS            ((FLASH_SECTOR_SIZE) / (RECORD_SIZE))
+#define SECTOR_ADDRESS(n)       (FLASH_RECORDS_BASE + (FLASH_RECORDS_SECTOR + (n)) * (FLASH_SECTOR_SIZE))
+#define SLOT_ADDRESS(n, slot)   (SECTOR_ADDRESS(n) + (slot) * (RECORD_SIZE))
+
+static_assert(FLASH_RECORD_HEADER == FLASHWORD_SIZE, "A record header must fill one FLASHWORD.");
+static_assert(0 == MARLIN_EEPROM_SIZE % SECTION_SIZE, "MARLIN_EEPROM_SIZE must be a multiple of 256 bytes.");
+static_assert(SECTIONS <= 32, "MARLIN_EEPROM_SIZE is too big for FLASH_EEPROM_RECORDS (8KB max).");
+static_assert(RECORD_SLOTS > 2 * (SECTIONS), "The flash sector is too small for FLASH_EEPROM_RECORDS.");
+static_assert(IS_FLASH_SECTOR(FLASH_RECORDS_SECTOR + 1), "FLASH_RECORDS_SECTOR is invalid");
+
+static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4)));
+
+static bool loaded = false,
+            group_open = false,     // A save is being written
+            compacting = false,     // The save being written holds the whole image
+            erase_needed = false;   // The spare sector must be erased before use
+static volatile bool erase_busy = false;
+
+static uint8_t active;              // Sector holding the log (0 or 1)
+static uint16_t write_slot;         // Next free record slot in the active sector
+static uint32_t dirty, pending,     // Sections changed since access_start / waiting for flash
+                next_seq, group_seq;
+
+/**
+ * Copy a record slot to RAM. A flash word torn by a reset mid-program fails
+ * its ECC check, and on H7 that read raises a bus fault. Bus faults are
+ * ignored during the copy (FAULTMASK with BFHFNMIGN) and the ECC flag tells
+ * whether the slot is damaged. Return false for a damaged slot.
+ */
+static bool read_slot(const uint8_t n, const uint16_t slot, flash_record_t &rec) {
+  const uint32_t ccr = SCB->CCR;
+  __set_FAULTMASK(1);
+  SCB->CCR = ccr | SCB_CCR_BFHFNMIGN_Msk;
+  __DSB(); __ISB();
+  memcpy(&rec, (const void*)SLOT_ADDRESS(n, slot), RECORD_SIZE);
+  __DSB();
+  SCB->CCR = ccr;
+  __ISB();
+  __set_FAULTMASK(0);
+
+  const bool ecc_error = __HAL_FLASH_GET_FLAG_BANK2(FLASH_FLAG_DBECCERR_BANK2);
+  __HAL_FLASH_CLEAR_FLAG_BANK2(FLASH_FLAG_DBECCERR_BANK2 | FLASH_FLAG_SNECCERR_BANK2);
+  return !ecc_error;
+}
+
+// Rebuild the RAM image from the newest save in the log
+static void load_log() {
+  FlashRecordLog log;
+  log.load(read_slot, RECORD_SLOTS, SECTIONS, ram_eeprom);
+  active = log.active;
+  write_slot = log.write_slot;
+  erase_needed = log.erase_needed;
+  next_seq = log.next_seq;
+
+  DEBUG_ECHOLNPGM("EEPROM records loaded from sector ", active, " (save ", log.best_seq, ").");
+  loaded = true;
+}
+
+static bool program(uint32_t address, const uint8_t *data, const uint16_t size) {
+  for (uint16_t i = 0; i < size; i += FLASHWORD_SIZE) {
+    const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, address + i, uint32_t(data + i));
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASH_Program=", status, " GetError=", HAL_FLASH_GetError(), " address=", address + i);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Append one section, data first so the header marks a complete record
+static bool write_record(const uint8_t s, const bool last) {
+  const uint8_t * const data = &ram_eeprom[s * (SECTION_SIZE)];
+  flash_record_header_t h;
+  memset(&h, 0xFF, sizeof(h));
+  h.magic = FLASH_RECORD_MAGIC;
+  h.seq = group_seq;
+  h.key = (FLASH_RECORD_FORMAT << 8) | s;
+  h.crc = 0;
+  crc16(&h.crc, data, SECTION_SIZE);
+  h.last = last;
+
+  const uint32_t address = SLOT_ADDRESS(active, write_slot);
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAGS_TO_CLEAR);
+  const bool ok = program(address + FLASHWORD_SIZE, data, SECTION_SIZE) && program(address, (const uint8_t*)&h, sizeof(h));
+  HAL_FLASH_Lock();
+
+  write_slot++;                     // Skip a failed slot
+  return ok;
+}
+
+static void start_erase(const uint8_t n) {
+  FLASH_EraseInitTypeDef erase;
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Banks = FLASH_RECORDS_BANK;
+  erase.Sector = FLASH_RECORDS_SECTOR + n;
+  erase.NbSectors = 1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAGS_TO_CLEAR);
+  HAL_NVIC_SetPriority(FLASH_IRQn, 15, 0);
+  HAL_NVIC_EnableIRQ(FLASH_IRQn);
+  erase_busy = true;
+  if (HAL_FLASHEx_Erase_IT(&erase) == HAL_OK)
+    erase_needed = false;
+  else {
+    erase_busy = false;
+    HAL_FLASH_Lock();
+    DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase_IT GetError=", HAL_FLASH_GetError());
+  }
+}
+
+extern "C" {
+  void FLASH_IRQHandler() { HAL_FLASH_IRQHandler(); }
+  void HAL_FLASH_EndOfOperationCallback(uint32_t) { HAL_FLASH_Lock(); erase_busy = false; }
+  void HAL_FLASH_OperationErrorCallback(uint32_t) { HAL_FLASH_Lock(); erase_busy = false; erase_needed = true; }
+}
+
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
+
+bool PersistentStore::access_start() {
+  if (!loaded) load_log();
+  return true;
+}
+
+// Queue the changed sections for the idle loop
+bool PersistentStore::access_finish() {
+  pending |= dirty;
+  dirty = 0;
+  return true;
+}
+
+/**
+ * Write one pending record, or erase the spare sector when there are none.
+ * Called from the idle loop while the planner is empty.
+ */
+void PersistentStore::idle() {
+  if (!loaded || erase_busy) return;
+
+  if (!pending) {
+    if (erase_needed) start_erase(active ^ 1);
+    return;
+  }
+
+  // Out of room? Write the whole image to the spare sector.
+  if (write_slot >= RECORD_SLOTS) {
+    if (erase_needed) return start_erase(active ^ 1);
+    active ^= 1;
+    write_slot = 0;
+    pending = ALL_SECTIONS;
+    group_open = false;
+    compacting = true;
+  }
+
+  if (!group_open) {
+    group_seq = next_seq++;
+    group_open = true;
+  }
+
+  uint8_t s = 0;
+  while (!TEST(pending, s)) s++;
+  CBI(pending, s);
+
+  if (!write_record(s, !pending)) {
+    SBI(pending, s);                // Try again in the next slot
+    return;
+  }
+
+  if (!pending) {
+    group_open = false;
+    if (compacting) { compacting = false; erase_needed = true; }
+    DEBUG_ECHOLNPGM("EEPROM records saved to sector ", active, " (save ", group_seq, ").");
+  }
+}
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  while (size--) {
+    uint8_t v = *value;
+    const int p = REAL_EEPROM_ADDR(pos);
+    if (v != ram_eeprom[p]) {
+      ram_eeprom[p] = v;
+      SBI(dirty, p / (SECTION_SIZE));
+    }
+    crc16(crc, &v, 1);
+    pos++;
+    value++;
+  }
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  do {
+    const uint8_t c = ram_eeprom[REAL_EEPROM_ADDR(pos)];
+    if (writing) *value = c;
+    crc16(crc, &c, 1);
+    pos++;
+    value++;
+  } while (--size);
+  return false;
+}
+
+#endif // FLASH_EEPROM_RECORDS
+#endif // HAL_STM32
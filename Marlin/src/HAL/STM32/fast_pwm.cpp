@@ -85,4 +85,11 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   timer_freq[index] = f_desired; // Save the last frequency so duty will not set the default for this timer number.
 }
 
+void MarlinHAL::init_pwm_timer(const pin_t pin) {
+  if (!PWM_PIN(pin)) return;
+  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(digitalPinToPinName(pin), PinMap_PWM);
+  if (HardwareTimer_Handle[get_timer_index(Instance)] == nullptr)
+    set_pwm_frequency(pin, PWM_FREQUENCY);
+}
+
 #endif // HAL_STM32
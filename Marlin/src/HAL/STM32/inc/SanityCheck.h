@@ -40,6 +40,18 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4/H7 hardware." // IRON
 #endif
 
+#if ENABLED(FLASH_EEPROM_RECORDS)
+  #if DISABLED(FLASH_EEPROM_EMULATION)
+    #error "FLASH_EEPROM_RECORDS requires FLASH_EEPROM_EMULATION."
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
+    #error "FLASH_EEPROM_RECORDS and FLASH_EEPROM_LEVELING are incompatible."
+  #elif NOT_TARGET(STM32H7xx)
+    #error "FLASH_EEPROM_RECORDS is currently only supported on STM32H7 hardware."
+  #elif !defined(DUAL_BANK)
+    #error "FLASH_EEPROM_RECORDS requires a dual-bank STM32H7, so flash writes don't stall the running code."
+  #endif
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
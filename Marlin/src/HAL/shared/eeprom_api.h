@@ -59,6 +59,11 @@ public:
   // Return 'true' on read error
   static bool read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing=true);
 
+  #if ENABLED(FLASH_EEPROM_RECORDS)
+    // Write queued data to flash in the background
+    static void idle();
+  #endif
+
   // Write one or more bytes of data
   // Return 'true' on write error
   static bool write_data(const int pos, const uint8_t *value, const size_t size=sizeof(uint8_t)) {
@@ -0,0 +1,132 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * flash_records.h
+ *
+ * Record format and boot scan for FLASH_EEPROM_RECORDS
+ *
+ * A record is { header, data } for one section of the EEPROM image. All
+ * records of a save share its save number and the last one is flagged.
+ * The flash access is left to the HAL, which passes a slot reader in, so
+ * the scan also runs on a log held in RAM.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../../libs/crc16.h"
+
+#define FLASH_RECORD_MAGIC    0x53524C4DUL  // "MLRS"
+#define FLASH_RECORD_FORMAT   1             // Bump when the section layout changes
+#define FLASH_RECORD_HEADER   32U           // One STM32H7 FLASHWORD
+#define FLASH_RECORD_SECTION  256U
+
+typedef struct {
+  uint32_t magic;               // FLASH_RECORD_MAGIC
+  uint32_t seq;                 // Save number, counting up across both sectors
+  uint16_t key;                 // FLASH_RECORD_FORMAT << 8 | section
+  uint16_t crc;                 // CRC16 of the section data
+  uint8_t last;                 // 1 on the last record of a save
+  uint8_t pad[FLASH_RECORD_HEADER - 13];
+} __attribute__((aligned(4))) flash_record_header_t;
+
+typedef struct {
+  flash_record_header_t header;
+  uint8_t data[FLASH_RECORD_SECTION];
+} __attribute__((aligned(4))) flash_record_t;
+
+static_assert(sizeof(flash_record_header_t) == FLASH_RECORD_HEADER, "flash_record_header_t must be FLASH_RECORD_HEADER bytes.");
+static_assert(sizeof(flash_record_t) == FLASH_RECORD_HEADER + FLASH_RECORD_SECTION, "flash_record_t must not be padded.");
+
+struct FlashRecordLog {
+  uint8_t active = 0;           // Sector holding the newest save (0 or 1)
+  uint16_t write_slot = 0;      // First free slot in the active sector
+  bool erase_needed = false;    // The other sector holds data
+  uint32_t next_seq = 0,        // Save number for the next save
+           best_seq = 0;        // Save number of the newest committed save
+
+  static bool is_blank(const flash_record_t &rec) {
+    const uint32_t *p = (const uint32_t*)&rec;
+    for (uint16_t i = 0; i < sizeof(rec) / sizeof(uint32_t); ++i) if (p[i] != 0xFFFFFFFFUL) return false;
+    return true;
+  }
+
+  // A complete record of this format with good data
+  static bool is_valid(const flash_record_t &rec, const uint8_t sections) {
+    const flash_record_header_t &h = rec.header;
+    if (h.magic != FLASH_RECORD_MAGIC || (h.key >> 8) != FLASH_RECORD_FORMAT || (h.key & 0xFF) >= sections) return false;
+    uint16_t crc = 0;
+    crc16(&crc, rec.data, FLASH_RECORD_SECTION);
+    return crc == h.crc;
+  }
+
+  /**
+   * Find the newest save in two sectors of the given number of slots and
+   * build the image from it. read_slot(n, slot, rec) copies a slot and
+   * returns false for a damaged one. Damaged slots count as used, but
+   * never as records. Sections with no record are left at 0xFF.
+   */
+  template<typename ReadSlot>
+  void load(ReadSlot read_slot, const uint16_t slots, const uint8_t sections, uint8_t * const image) {
+    const uint32_t all = sections < 32 ? (1UL << sections) - 1 : 0xFFFFFFFFUL;
+    int16_t last_commit[2] = { -1, -1 };
+    uint16_t end[2] = { 0, 0 };
+    flash_record_t rec;
+
+    *this = FlashRecordLog();
+    for (uint8_t n = 0; n < 2; ++n) {
+      for (uint16_t slot = 0; slot < slots; ++slot) {
+        const bool readable = read_slot(n, slot, rec);
+        if (readable && is_blank(rec)) continue;
+        end[n] = slot + 1;
+        if (!readable || !is_valid(rec, sections)) continue;
+        const flash_record_header_t &h = rec.header;
+        if (h.seq >= next_seq) next_seq = h.seq + 1;
+        if (h.last && h.seq >= best_seq) {
+          best_seq = h.seq;
+          active = n;
+          last_commit[n] = slot;
+        }
+      }
+    }
+
+    write_slot = end[active];
+    erase_needed = end[active ^ 1] > 0;
+
+    // Walk back from the last commit, taking the newest record of each section.
+    // No save has the starting number, so the first record read opens a save.
+    memset(image, 0xFF, sections * FLASH_RECORD_SECTION);
+    uint32_t filled = 0, cur_seq = 0xFFFFFFFFUL;
+    bool cur_ok = false;
+    for (int16_t slot = last_commit[active]; slot >= 0 && filled != all; --slot) {
+      if (!read_slot(active, slot, rec) || !is_valid(rec, sections)) continue;
+      const flash_record_header_t &h = rec.header;
+      if (h.seq != cur_seq) { cur_seq = h.seq; cur_ok = h.last; } // A save's last record comes first
+      const uint8_t s = h.key & 0xFF;
+      if (!cur_ok || (filled & (1UL << s))) continue;
+      memcpy(&image[s * FLASH_RECORD_SECTION], rec.data, FLASH_RECORD_SECTION);
+      filled |= 1UL << s;
+    }
+  }
+};
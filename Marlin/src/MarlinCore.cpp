@@ -53,6 +53,9 @@
 #if ENABLED(FT_MOTION)
   #include "module/ft_motion.h"
 #endif
+#if ENABLED(SEGMENT_COALESCING)
+  #include "module/coalescer.h"
+#endif
 
 #include "gcode/gcode.h"
 #include "gcode/parser.h"
@@ -160,6 +163,22 @@
   #include "feature/spindle_laser.h"
 #endif
 
+#if ENABLED(UV_EXPOSURE_HEAD)
+  #include "feature/uv_exposure.h"
+#endif
+
+#if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+  #include "feature/camera_capture.h"
+#endif
+
+#if ENABLED(PREFLIGHT_SCAN)
+  #include "feature/preflight.h"
+#endif
+
+#if ENABLED(FLASH_EEPROM_RECORDS)
+  #include "HAL/shared/eeprom_api.h"
+#endif
+
 #if HAS_MEDIA
   CardReader card;
 #endif
@@ -478,6 +497,9 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
     }
   #endif
 
+  // Release queued camera triggers and report their positions
+  TERN_(CAMERA_CAPTURE_SCHEDULER, cameraCapture.idle(ms));
+
   #if HAS_KILL
 
     // Check if the kill button was pressed and wait to ensure the signal is not noise
@@ -776,6 +798,11 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     if (++idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth);
   #endif
 
+  // Send report output held by a command that is waiting
+  #ifdef SERIAL_REPORT_BUFFER
+    reportSerial.flushBlock();
+  #endif
+
   // Bed Distance Sensor task
   TERN_(BD_SENSOR, bdl.process());
 
@@ -811,6 +838,17 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     if (card.isStillPrinting()) recovery.outage();
   #endif
 
+  // Append the latest recovery state to the power-loss journal
+  TERN_(POWER_LOSS_JOURNAL, recovery.journal_idle());
+
+  // Scan the selected media file in the background
+  TERN_(PREFLIGHT_SCAN, preflight.idle());
+
+  // Write saved settings to flash while the planner is empty
+  #if ENABLED(FLASH_EEPROM_RECORDS)
+    if (!planner.has_blocks_queued()) persistentStore.idle();
+  #endif
+
   // Run StallGuard endstop checks
   #if ENABLED(SPI_ENDSTOPS)
     if (endstops.tmc_spi_homing.any && TERN1(IMPROVE_HOMING_RELIABILITY, ELAPSED(millis(), sg_guard_period)))
@@ -882,6 +920,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Update the LVGL interface
   TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
 
+  // Send a held G0/G1 move once the planner runs low
+  TERN_(SEGMENT_COALESCING, coalescer.task());
+
   // Manage Fixed-time Motion Control
   TERN_(FT_MOTION, ftMotion.loop());
 
@@ -899,6 +940,7 @@ void kill(FSTR_P const lcd_error/*=nullptr*/, FSTR_P const lcd_component/*=nullp
   thermalManager.disable_all_heaters();
 
   TERN_(HAS_CUTTER, cutter.kill()); // Full cutter shutdown including ISR control
+  TERN_(UV_EXPOSURE_HEAD, uvExposure.off());
 
   // Echo the LCD message to serial for extra context
   if (lcd_error) { SERIAL_ECHO_START(); SERIAL_ECHOLN(lcd_error); }
@@ -935,6 +977,7 @@ void minkill(const bool steppers_off/*=false*/) {
   thermalManager.disable_all_heaters();
 
   TERN_(HAS_CUTTER, cutter.kill());  // Reiterate cutter shutdown
+  TERN_(UV_EXPOSURE_HEAD, uvExposure.off());
 
   // Power off all steppers (for M112) or just the E steppers
   steppers_off ? stepper.disable_all_steppers() : stepper.disable_e_steppers();
@@ -1307,7 +1350,7 @@ void setup() {
     );
   #endif
   SERIAL_ECHO_MSG(" Compiled: " __DATE__);
-  SERIAL_ECHO_MSG(STR_FREE_MEMORY, hal.freeMemory(), STR_PLANNER_BUFFER_BYTES, sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+  SERIAL_ECHO_MSG(STR_FREE_MEMORY, hal.freeMemory(), STR_PLANNER_BUFFER_BYTES, sizeof(Planner::block_buffer));
 
   // Some HAL need precise delay adjustment
   calibrate_delay_loop();
@@ -1417,6 +1460,14 @@ void setup() {
     SETUP_RUN(cutter.init());
   #endif
 
+  #if ENABLED(UV_EXPOSURE_HEAD)
+    SETUP_RUN(uvExposure.init());
+  #endif
+
+  #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+    SETUP_RUN(cameraCapture.init());
+  #endif
+
   #if ENABLED(COOLANT_MIST)
     OUT_WRITE(COOLANT_MIST_PIN, COOLANT_MIST_INVERT);   // Init Mist Coolant OFF
   #endif
@@ -71,6 +71,10 @@ MAP(_N_LBL, LOGICAL_AXIS_NAMES); MAP(_SP_N_LBL, LOGICAL_AXIS_NAMES);
 
 #endif
 
+#ifdef SERIAL_REPORT_BUFFER
+  SerialReportT reportSerial(_SERIAL_IMPL);
+#endif
+
 // Specializations for float, p_float_t, w_float_t
 template <> void SERIAL_ECHO(const float f)      { SERIAL_IMPL.print(f, SERIAL_FLOAT_PRECISION); }
 template <> void SERIAL_ECHO(const p_float_t pf) { SERIAL_IMPL.print(pf.value, pf.prec); }
@@ -89,7 +93,11 @@ void SERIAL_FLUSH()    { SERIAL_IMPL.flush(); }
 void SERIAL_FLUSHTX()  { SERIAL_IMPL.flushTX(); }
 
 void SERIAL_ECHO_P(PGM_P pstr) {
-  while (const char c = pgm_read_byte(pstr++)) SERIAL_CHAR(c);
+  #ifdef __AVR__
+    while (const char c = pgm_read_byte(pstr++)) SERIAL_CHAR(c);
+  #else
+    serial_write_block(SERIAL_IMPL, (const uint8_t*)pstr, strlen_P(pstr)); // PROGMEM is ordinary memory here
+  #endif
 }
 void SERIAL_ECHOLN_P(PGM_P pstr) { SERIAL_ECHO_P(pstr); SERIAL_EOL(); }
 
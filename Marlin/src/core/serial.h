@@ -112,12 +112,47 @@ extern uint8_t marlin_debug_flags;
   #undef _S_MULTI
 
   extern SerialOutputT        multiSerial;
-  #define SERIAL_IMPL         multiSerial
+  #define _SERIAL_IMPL        multiSerial
 #else
   #define _PORT_REDIRECT(n,p) NOOP
   #define _PORT_RESTORE(n)    NOOP
   #define SERIAL_ASSERT(P)    NOOP
-  #define SERIAL_IMPL         SERIAL_LEAF_1
+  #define _SERIAL_IMPL        SERIAL_LEAF_1
+#endif
+
+// Step 3: Collect report output in a buffer so each report is sent in one block
+#ifdef SERIAL_REPORT_BUFFER
+  typedef BufferedSerial<decltype(_SERIAL_IMPL), SERIAL_REPORT_BUFFER> SerialReportT;
+  extern SerialReportT        reportSerial;
+  #define SERIAL_IMPL         reportSerial
+
+  // Buffer the output from here to the end of the scope. Ports changed within the scope and idle() send what is collected.
+  struct SerialReportScope {
+    SerialReportScope()  { reportSerial.beginReport(); }
+    ~SerialReportScope() { reportSerial.endReport(); }
+  };
+  #define SERIAL_REPORT_SCOPE() SerialReportScope _report_scope
+
+  #if HAS_MULTI_SERIAL
+    // Send the collected output to the ports it was written for before changing ports
+    class SerialPortRestorer {
+      SerialMask saved;
+    public:
+      SerialPortRestorer(const SerialMask mask) : saved(multiSerial.portMask) {
+        reportSerial.flushBlock();
+        multiSerial.portMask = mask;
+      }
+      ~SerialPortRestorer() { restore(); }
+      void restore() { reportSerial.flushBlock(); multiSerial.portMask = saved; }
+    };
+    #undef _PORT_REDIRECT
+    #undef _PORT_RESTORE
+    #define _PORT_REDIRECT(n,p) SerialPortRestorer port_restorer_##n(p)
+    #define _PORT_RESTORE(n)    port_restorer_##n.restore()
+  #endif
+#else
+  #define SERIAL_IMPL         _SERIAL_IMPL
+  #define SERIAL_REPORT_SCOPE() NOOP
 #endif
 
 #define PORT_REDIRECT(p)   _PORT_REDIRECT(1,p)
@@ -24,6 +24,7 @@
 #include "../inc/MarlinConfigPre.h"
 
 #include <stddef.h> // for size_t
+#include <string.h> // for strlen
 
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
@@ -72,6 +73,24 @@ CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
 
+// Detect a block write(const uint8_t*, size_t) at compile time. Only some HAL serial classes have one.
+namespace Private {
+  template <typename Type, typename Yes=char, typename No=long> struct HasBlockWrite {
+    template <typename C> static Yes& test(decltype(static_cast<C*>(nullptr)->write(static_cast<const uint8_t*>(nullptr), size_t(0)), 0) *);
+    template <typename C> static No& test(...);
+    enum { value = sizeof(test<Type>(nullptr)) == sizeof(Yes) };
+  };
+}
+
+// Hand a block to a serial class in one call if it can take one, else one byte at a time
+template <typename SerialT>
+FORCE_INLINE typename Private::enable_if<Private::HasBlockWrite<SerialT>::value>::type
+serial_write_block(SerialT &out, const uint8_t *buffer, size_t size) { out.write(buffer, size); }
+
+template <typename SerialT>
+FORCE_INLINE typename Private::enable_if<!Private::HasBlockWrite<SerialT>::value>::type
+serial_write_block(SerialT &out, const uint8_t *buffer, size_t size) { while (size--) out.write(*buffer++); }
+
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
 struct EnsureDouble {
@@ -138,8 +157,8 @@ struct SerialBase {
   void flushTX()                    { CALL_IF_EXISTS(void, SerialChild, flushTX); }
 
   // Glue code here
-  void write(const char *str)                    { while (*str) write(*str++); }
-  void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
+  void write(const char *str)                    { write((const uint8_t*)str, strlen(str)); }
+  void write(const uint8_t *buffer, size_t size) { serial_write_block(*SerialChild, buffer, size); }
   void print(char *str)                          { write(str); }
   void print(const char *str)                    { write(str); }
   // No default argument to avoid ambiguity
@@ -185,7 +204,7 @@ struct SerialBase {
   void println(const char *s)         { print(s); println(); }
   void println(float c, int digits)   { print(c, digits); println(); }
   void println(double c, int digits)  { print(c, digits); println(); }
-  void println()                      { write('\r'); write('\n'); }
+  void println()                      { write((const uint8_t*)"\r\n", 2); }
 
   // Default implementations for types without a specialization. Handles integers.
   template <typename T>
@@ -198,38 +217,50 @@ struct SerialBase {
   void println(float c)               { println(c, 2); }
   void println(double c)              { println(c, 2); }
 
+  // Format an unsigned number backwards from the end of a buffer, returning the first character
+  static char* formatNumber(char *end, uint_fixed_print_t n, const PrintBase base) {
+    if (base == PrintBase::Dec) {
+      // A constant divisor lets the compiler use a multiply
+      do { *--end = '0' + n % 10; n /= 10; } while (n);
+      return end;
+    }
+    do {
+      const uint8_t d = n % (uint_fixed_print_t)base;
+      *--end = d + (d < 10 ? '0' : 'A' - 10);
+      n /= (uint_fixed_print_t)base;
+    } while (n);
+    return end;
+  }
+
   // Print a number with the given base
   NO_INLINE void printNumber_unsigned(uint_fixed_print_t n, PrintBase base) {
-    if (n) {
-      unsigned char buf[8 * sizeof(long)]; // Enough space for base 2
-      int8_t i = 0;
-      while (n) {
-        buf[i++] = n % (uint_fixed_print_t)base;
-        n /= (uint_fixed_print_t)base;
-      }
-      while (i--) write((char)(buf[i] + (buf[i] < 10 ? '0' : 'A' - 10)));
-    }
-    else write('0');
+    char buf[8 * sizeof(long)]; // Enough space for base 2
+    char * const end = buf + sizeof(buf), * const start = formatNumber(end, n, base);
+    write((const uint8_t*)start, end - start);
   }
 
   NO_INLINE void printNumber_signed(int_fixed_print_t n, PrintBase base) {
-    if (base == PrintBase::Dec && n < 0) {
-      n = -n; // This works because all platforms Marlin's builds on are using 2-complement encoding for negative number
-              // On such CPU, changing the sign of a number is done by inverting the bits and adding one, so if n = 0x80000000 = -2147483648 then
-              // -n = 0x7FFFFFFF + 1 => 0x80000000 = 2147483648 (if interpreted as unsigned) or -2147483648 if interpreted as signed.
-              // On non 2-complement CPU, there would be no possible representation for 2147483648.
-      write('-');
-    }
-    printNumber_unsigned((uint_fixed_print_t)n, base);
+    char buf[8 * sizeof(long) + 1];
+    char * const end = buf + sizeof(buf);
+    const bool neg = base == PrintBase::Dec && n < 0;
+    // This works because all platforms Marlin's builds on are using 2-complement encoding for negative number
+    // On such CPU, changing the sign of a number is done by inverting the bits and adding one, so if n = 0x80000000 = -2147483648 then
+    // -n = 0x7FFFFFFF + 1 => 0x80000000 = 2147483648 (if interpreted as unsigned) or -2147483648 if interpreted as signed.
+    // On non 2-complement CPU, there would be no possible representation for 2147483648.
+    char *start = formatNumber(end, (uint_fixed_print_t)(neg ? -n : n), base);
+    if (neg) *--start = '-';
+    write((const uint8_t*)start, end - start);
   }
 
   // Print a decimal number
   NO_INLINE void printFloat(double number, uint8_t digits) {
+    // Sign and integer part go before the middle, the decimals after
+    char buf[8 * sizeof(long) + 16];
+    char * const mid = buf + 8 * sizeof(long);
+
     // Handle negative numbers
-    if (number < 0.0) {
-      write('-');
-      number = -number;
-    }
+    const bool neg = number < 0.0;
+    if (neg) number = -number;
 
     // Round correctly so that print(1.999, 2) prints as "2.00"
     double rounding = 0.5;
@@ -237,21 +268,26 @@ struct SerialBase {
     number += rounding;
 
     // Extract the integer part of the number and print it
-    unsigned long int_part = (unsigned long)number;
+    const unsigned long int_part = (unsigned long)number;
     double remainder = number - (double)int_part;
-    printNumber_unsigned(int_part, PrintBase::Dec);
+    char *start = formatNumber(mid, int_part, PrintBase::Dec), *p = mid;
+    if (neg) *--start = '-';
 
     // Print the decimal point, but only if there are digits beyond
     if (digits) {
-      write('.');
+      *p++ = '.';
       // Extract digits from the remainder one at a time
+      NOMORE(digits, uint8_t(buf + sizeof(buf) - p));
       while (digits--) {
         remainder *= 10.0;
-        unsigned long toPrint = (unsigned long)remainder;
-        printNumber_unsigned(toPrint, PrintBase::Dec);
+        const uint8_t toPrint = (uint8_t)remainder;
+        *p++ = '0' + toPrint;
         remainder -= toPrint;
       }
     }
+
+    // The whole number goes out in one write
+    write((const uint8_t*)start, p - start);
   }
 };
 
@@ -94,6 +94,7 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   bool    & condition;
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { if (condition) return out.write(c); return 0; }
+  void write(const uint8_t *buffer, size_t size) { if (condition) serial_write_block(out, buffer, size); }
   void flush()                      { if (condition) out.flush();  }
   void begin(long br)               { out.begin(br); }
   void end()                        { out.end(); }
@@ -118,6 +119,7 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
 
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { return out.write(c); }
+  void write(const uint8_t *buffer, size_t size) { serial_write_block(out, buffer, size); }
   void flush()            { out.flush();  }
   void begin(long br)     { out.begin(br); }
   void end()              { out.end(); }
@@ -151,6 +153,10 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
     if (writeHook) writeHook(userPointer, c);
     return SerialT::write(c);
   }
+  NO_INLINE void write(const uint8_t *buffer, size_t size) {
+    if (writeHook) for (size_t i = 0; i < size; ++i) writeHook(userPointer, buffer[i]);
+    serial_write_block(*static_cast<SerialT*>(this), buffer, size);
+  }
 
   NO_INLINE void msgDone() {
     if (eofHook) eofHook(userPointer);
@@ -228,6 +234,11 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     REPEAT(NUM_SERIAL, _S_WRITE);
     #undef _S_WRITE
   }
+  NO_INLINE void write(const uint8_t *buffer, size_t size) {
+    #define _S_WRITE(N) if (portMask.enabled(output[N])) serial_write_block(serial##N, buffer, size);
+    REPEAT(NUM_SERIAL, _S_WRITE);
+    #undef _S_WRITE
+  }
   NO_INLINE void msgDone() {
     #define _S_DONE(N) if (portMask.enabled(output[N])) serial##N.msgDone();
     REPEAT(NUM_SERIAL, _S_DONE);
@@ -297,6 +308,58 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
 
 };
 
+// A class that collects the output of a report and passes it on in as few blocks as possible.
+// Output outside of a report goes straight through.
+template <class SerialT, uint16_t SIZE>
+struct BufferedSerial : public SerialBase< BufferedSerial<SerialT, SIZE> > {
+  typedef SerialBase< BufferedSerial<SerialT, SIZE> > BaseClassT;
+
+  SerialT & out;
+  uint8_t   depth;    // Nesting level of reports
+  uint16_t  length;   // Bytes waiting in the buffer
+  uint8_t   buffer[SIZE];
+
+  NO_INLINE size_t write(uint8_t c) {
+    if (!depth) return out.write(c), 1;
+    if (length == SIZE) flushBlock();
+    buffer[length++] = c;
+    return 1;
+  }
+  NO_INLINE void write(const uint8_t *data, size_t size) {
+    if (depth && length + size > SIZE) flushBlock();
+    if (!depth || size > SIZE) return serial_write_block(out, data, size);
+    memcpy(buffer + length, data, size);
+    length += size;
+  }
+
+  // Send everything collected so far
+  void flushBlock() {
+    if (!length) return;
+    serial_write_block(out, buffer, length);
+    length = 0;
+  }
+
+  void beginReport() { ++depth; }
+  void endReport()   { if (depth && !--depth) flushBlock(); }
+
+  void flush()        { flushBlock(); out.flush(); }
+  void flushTX()      { flushBlock(); CALL_IF_EXISTS(void, &out, flushTX); }
+  void begin(long br) { out.begin(br); }
+  void end()          { flushBlock(); out.end(); }
+
+  void msgDone()      { flushBlock(); out.msgDone(); }
+  bool connected()    { return CALL_IF_EXISTS(bool, &out, connected); }
+
+  int available(serial_index_t index) { return out.available(index); }
+  int read(serial_index_t index)      { return out.read(index); }
+  SerialFeature features(serial_index_t index) const { return out.features(index); }
+
+  using BaseClassT::available;
+  using BaseClassT::read;
+
+  BufferedSerial(SerialT & out, const bool e=false) : BaseClassT(e), out(out), depth(0), length(0) {}
+};
+
 // Build the actual serial object depending on current configuration
 #define Serial1Class TERN(SERIAL_RUNTIME_HOOK, RuntimeSerial, BaseSerial)
 #define ForwardSerial1Class TERN(SERIAL_RUNTIME_HOOK, RuntimeSerial, ForwardSerial)
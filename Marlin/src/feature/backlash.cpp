@@ -119,7 +119,7 @@ void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm,
       #ifdef BACKLASH_SMOOTHING_MM
         if (error_correction && smoothing_mm != 0) {
           // Take up a portion of the residual_error in this segment
-          if (segment_proportion == 0) segment_proportion = _MIN(1.0f, block->millimeters / smoothing_mm);
+          if (segment_proportion == 0) segment_proportion = _MIN(1.0f, planner.plan_of(block).millimeters / smoothing_mm);
           error_correction = CEIL(segment_proportion * error_correction);
         }
       #endif
@@ -160,8 +160,10 @@ void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm,
 
   // If backlash correction steps were added modify block->millimeters with a linear approximation
   // See https://github.com/MarlinFirmware/Marlin/pull/26392
-  if (changed)
-    block->millimeters += TERN(IS_KINEMATIC, millimeters_delta * block->millimeters / sqr_stepper_space_mm, millimeters_delta / block->millimeters);
+  if (changed) {
+    float &millimeters = planner.plan_of(block).millimeters;
+    millimeters += TERN(IS_KINEMATIC, millimeters_delta * millimeters / sqr_stepper_space_mm, millimeters_delta / millimeters);
+  }
 }
 
 int32_t Backlash::get_applied_steps(const AxisEnum axis) {
@@ -0,0 +1,132 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/camera_capture.cpp - Camera triggers carried through the planner
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+
+#include "camera_capture.h"
+#include "../module/stepper.h"
+
+CameraCapture cameraCapture;
+
+float CameraCapture::interval_mm,
+      CameraCapture::path_mm;
+bool CameraCapture::every_layer,
+     CameraCapture::layer_started,
+     CameraCapture::due;
+int32_t CameraCapture::layer_z;
+
+capture_stamp_t CameraCapture::stamps[CAMERA_CAPTURE_STAMPS];
+volatile uint8_t CameraCapture::stamp_head,
+                 CameraCapture::stamp_tail;
+volatile uint16_t CameraCapture::next_id;
+volatile millis_t CameraCapture::release_ms;
+
+void CameraCapture::init() {
+  OUT_WRITE(CHDK_PIN, LOW);
+  reset();
+}
+
+void CameraCapture::reset() {
+  interval_mm = path_mm = 0;
+  every_layer = layer_started = due = false;
+  next_id = 0;
+}
+
+float CameraCapture::plan_move(const_float_t mm, const bool extruding, const int32_t z, const bool can_carry) {
+  float at = 0;
+
+  if (extruding) {
+    // Printing at a higher Z means the layer below is done
+    if (every_layer) {
+      if (layer_started && z > layer_z) due = true;
+      layer_z = z;
+      layer_started = true;
+    }
+
+    // Find where the path interval runs out inside this move
+    if (interval_mm > 0) {
+      const float before = path_mm;
+      path_mm += mm;
+      if (path_mm >= interval_mm) {
+        if (!due) at = _MAX(0.0f, (interval_mm - before) / mm);
+        due = true;
+        path_mm -= interval_mm;
+        NOMORE(path_mm, interval_mm);       // Catch up one capture per move at most
+      }
+    }
+  }
+
+  // A move that already carries an output event passes the capture on
+  if (!due || !can_carry) return -1;
+  due = false;
+  return at;
+}
+
+void CameraCapture::stamp() {
+  release_ms = millis() + PHOTO_SWITCH_MS;
+
+  const uint16_t id = next_id;
+  next_id = id + 1;
+
+  // A full ring drops the stamp. The host sees a gap in the numbering.
+  const uint8_t h = stamp_head, next = (h + 1) % CAMERA_CAPTURE_STAMPS;
+  if (next == stamp_tail) return;
+
+  capture_stamp_t &s = stamps[h];
+  s.id = id;
+  s.ms = millis();
+  // Called from the Stepper ISR, where stepper.position() would turn interrupts back on
+  s.pos.set(stepper.count_position.x, stepper.count_position.y, stepper.count_position.z);
+  stamp_head = next;
+}
+
+void CameraCapture::idle(const millis_t ms) {
+  if (release_ms) {
+    // Don't let a new trigger slip in between the check and the release
+    hal.isr_off();
+    if (release_ms && ELAPSED(ms, release_ms)) {
+      release_ms = 0;
+      WRITE(CHDK_PIN, LOW);
+    }
+    hal.isr_on();
+  }
+
+  while (stamp_tail != stamp_head) {
+    const capture_stamp_t &s = stamps[stamp_tail];
+    SERIAL_ECHOLNPGM(
+      "Capture:", s.id,
+      " X:", p_float_t(s.pos.x * planner.mm_per_step[X_AXIS], 3),
+      " Y:", p_float_t(s.pos.y * planner.mm_per_step[Y_AXIS], 3),
+      " Z:", p_float_t(s.pos.z * planner.mm_per_step[Z_AXIS], 3),
+      " T:", s.ms
+    );
+    stamp_tail = (stamp_tail + 1) % CAMERA_CAPTURE_STAMPS;
+  }
+}
+
+#endif // CAMERA_CAPTURE_SCHEDULER
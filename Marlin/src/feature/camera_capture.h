@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/camera_capture.h - Camera triggers carried through the planner
+ *
+ * A capture is an output event that raises CHDK_PIN at a point in the
+ * motion stream. The Stepper ISR stamps each trigger with the stepper
+ * position and the main loop reports it to the host, so imaging never
+ * parks the head or stalls the queue.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+
+#include "../module/planner.h"
+
+#ifndef CAMERA_CAPTURE_STAMPS
+  #define CAMERA_CAPTURE_STAMPS 8
+#endif
+
+typedef struct {
+  uint16_t id;                              // Capture number since M724 R
+  millis_t ms;                              // Time of the trigger
+  xyz_long_t pos;                           // Stepper position at the trigger
+} capture_stamp_t;
+
+class CameraCapture {
+public:
+  static float interval_mm;                 // M724 S - Capture every interval of printed path. 0 to disable.
+  static bool every_layer;                  // M724 L - Capture when printing resumes at a higher Z
+
+  static void init();
+  static void reset();
+
+  // Queue a capture, after some travel if given
+  static void queue(const_float_t after_mm=0) { planner.buffer_output_event(trigger_event(), after_mm); }
+
+  // Planner: account for a move and return where in it to capture, or -1
+  static float plan_move(const_float_t mm, const bool extruding, const int32_t z, const bool can_carry);
+
+  static output_event_t trigger_event() { return { CHDK_PIN, HIGH, false, true }; }
+
+  // Stepper ISR: record a trigger
+  static void stamp();
+
+  // Main loop: release the trigger and report stamps
+  static void idle(const millis_t ms);
+
+private:
+  static float path_mm;                     // Printed path since the last capture
+  static int32_t layer_z;                   // Z of the last printing move, in steps
+  static bool layer_started, due;
+
+  static capture_stamp_t stamps[CAMERA_CAPTURE_STAMPS];
+  static volatile uint8_t stamp_head, stamp_tail;
+  static volatile uint16_t next_id;
+  static volatile millis_t release_ms;
+};
+
+extern CameraCapture cameraCapture;
+
+#endif // CAMERA_CAPTURE_SCHEDULER
@@ -63,6 +63,87 @@ void CancelObject::uncancel_object(const int8_t obj) {
   }
 }
 
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+
+  #include "../sd/cardreader.h"
+
+  bool CancelObject::seeking, // = false
+       CancelObject::seek_held; // = false
+
+  // The state the passed-over moves left behind, to be handed on by M486 X Y Z E F
+  static bool seek_relative;                      // G91 seen by the SD reader
+  static float seek_xyz[3], seek_e, seek_f;
+  static uint8_t seek_xyz_bits;                   // Axes in seek_xyz
+  static bool seek_has_e, seek_has_f;
+
+  /**
+   * Track the object the SD reader is in, and G90 / G91 for the moves passed over.
+   * This runs ahead of the queue, so it only sees cancels that were made before
+   * the object was reached.
+   */
+  void CancelObject::early_parse(const char * const cmd) {
+    const char *p = cmd;
+    while (*p == ' ') ++p;
+    if (p[0] == 'G' && p[1] == '9' && (p[2] == '0' || p[2] == '1') && !NUMERIC(p[3]) && p[3] != '.') {
+      seek_relative = p[2] == '1';
+      return;
+    }
+    if (p[0] != 'M' || p[1] != '4' || p[2] != '8' || p[3] != '6' || NUMERIC(p[4])) return;
+    for (p += 4; *p; ++p) {
+      if (*p == 'T') seeking = false;
+      else if (*p == 'S') {
+        const int obj = atoi(p + 1);
+        seeking = WITHIN(obj, 0, 31) && is_canceled(obj);
+      }
+    }
+  }
+
+  /**
+   * A line that can be passed over: blank, a comment, G0-G3, or G92 setting only E.
+   * Collects the XYZ, E, and feedrate that the line would have left behind.
+   * In G91 mode the XYZ of the moves are added up.
+   */
+  bool CancelObject::can_seek_past(const char *p) {
+    while (*p == ' ') ++p;
+    if (!*p) return true;
+    if (*p++ != 'G' || !NUMERIC(*p)) return false;
+
+    uint8_t code = 0;
+    while (NUMERIC(*p)) { code = code * 10 + (*p++ - '0'); if (code > 92) return false; }
+    if (*p == '.') return false;                  // Subcodes like G92.9
+
+    const bool is_move = code <= 3;
+    if (!is_move && code != 92) return false;
+
+    for (; *p; ++p) {
+      if (*p == 'E') { seek_e = strtof(p + 1, nullptr); seek_has_e = true; }
+      else if (is_move && *p == 'F') { seek_f = strtof(p + 1, nullptr); seek_has_f = true; }
+      else if (is_move && WITHIN(*p, 'X', 'Z')) {
+        const uint8_t a = *p - 'X';
+        seek_xyz[a] = (seek_relative && TEST(seek_xyz_bits, a) ? seek_xyz[a] : 0) + strtof(p + 1, nullptr);
+        SBI(seek_xyz_bits, a);
+      }
+      else if (!is_move && !(NUMERIC(*p) || *p == ' ' || *p == '.' || *p == '-')) return false;
+    }
+    return true;
+  }
+
+  // Write "M486 X Y Z E F" for the state the passed-over moves left behind
+  bool CancelObject::seek_state(char * const cmd) {
+    if (!seek_xyz_bits && !seek_has_e && !seek_has_f) return false;
+    MString<MAX_CMD_SIZE> m(F("M486"));
+    for (uint8_t a = 0; a < 3; ++a)
+      if (TEST(seek_xyz_bits, a)) m.append(' ', char('X' + a), p_float_t(seek_xyz[a], 3));
+    if (seek_has_e) m.append(F(" E"), p_float_t(seek_e, 5));
+    if (seek_has_f) m.append(F(" F"), p_float_t(seek_f, 1));
+    strcpy(cmd, &m);
+    seek_xyz_bits = 0;
+    seek_has_e = seek_has_f = false;
+    return true;
+  }
+
+#endif // CANCEL_OBJECTS_SEEK
+
 void CancelObject::report() {
   if (state.active_object >= 0)
     SERIAL_ECHO_MSG("Active Object: ", state.active_object);
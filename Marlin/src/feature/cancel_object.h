@@ -40,6 +40,66 @@ public:
   static void clear_active_object() { set_active_object(-1); }
   static void cancel_active_object() { cancel_object(state.active_object); }
   static void reset() { state.canceled = 0x0000; state.object_count = 0; clear_active_object(); }
+
+  #if ENABLED(CANCEL_OBJECTS_SEEK)
+    static bool seeking;                          // The SD reader is inside a canceled object
+    static bool seek_held;                        // The scan stopped at a line to run. Held until the line ends.
+    static void early_parse(const char * const cmd);
+    static bool can_seek_past(const char *p);
+    template<typename R> static bool seek_moves(R &reader);
+    static bool seek_state(char * const cmd);
+  #endif
 };
 
 extern CancelObject cancelable;
+
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+
+  /**
+   * Move the read position of a file reader (e.g., the SD card) past the moves of a canceled object.
+   * Return true when stopped at a line to run as usual, or at the end of the file.
+   * Return false after CANCEL_OBJECTS_SEEK_BYTES, to continue on the next call.
+   * Call only at the start of a line.
+   */
+  template<typename R>
+  bool CancelObject::seek_moves(R &reader) {
+    const uint32_t start = reader.getIndex(), limit = start + (CANCEL_OBJECTS_SEEK_BYTES);
+    uint32_t pos = start, line_start = start;
+    char line[64];
+    uint8_t len = 0;
+    bool in_comment = false, overflow = false;
+
+    for (;;) {
+      uint8_t buf[64];
+      const int16_t n = reader.read(buf, sizeof(buf));
+      if (n <= 0) break;                          // End of the file. Any last line runs as usual.
+
+      for (int16_t i = 0; i < n; ++i) {
+        const char c = buf[i];
+        ++pos;
+        if (ISEOL(c)) {
+          line[len] = '\0';
+          if (overflow || !can_seek_past(line)) { reader.setIndex(line_start); return true; }
+          line_start = pos;
+          len = 0;
+          in_comment = overflow = false;
+        }
+        else if (c == ';')
+          in_comment = true;
+        else if (!in_comment) {
+          if (len < sizeof(line) - 1) line[len++] = c; else overflow = true;
+        }
+      }
+
+      // Stop for now, unless a single line is longer than the limit
+      if (pos >= limit) {
+        reader.setIndex(line_start);
+        return line_start == start;
+      }
+    }
+
+    reader.setIndex(line_start);
+    return true;
+  }
+
+#endif // CANCEL_OBJECTS_SEEK
@@ -57,6 +57,9 @@ namespace DirectStepping {
   template<typename Cfg>
   volatile bool SerialPageManager<Cfg>::page_states_dirty;
 
+  template<typename Cfg>
+  bool SerialPageManager<Cfg>::local_source;
+
   template<typename Cfg>
   uint8_t SerialPageManager<Cfg>::pages[Cfg::PAGE_COUNT][Cfg::PAGE_SIZE];
 
@@ -179,7 +182,8 @@ namespace DirectStepping {
       return;
     }
 
-    if (!page_states_dirty) return;
+    // A local source has no host waiting for page states
+    if (!page_states_dirty || local_source) return;
     page_states_dirty = false;
 
     SERIAL_CHAR(Cfg::CONTROL_CHAR);
@@ -221,6 +225,58 @@ namespace DirectStepping {
     set_page_state(page_idx, PageState::FREE);
   }
 
+  template <>
+  bool PageManager::claim_page(page_idx_t &page_idx) {
+    for (page_idx_t i = 0; i < Config::PAGE_COUNT; i++) {
+      if (page_states[i] == PageState::FREE) {
+        page_states[i] = PageState::WRITING;
+        page_idx = i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <>
+  void PageManager::commit_page(const page_idx_t page_idx) {
+    set_page_state(page_idx, PageState::OK);
+  }
+
+  #if HAS_QS_STEP_PAGES
+
+    uint16_t qs_page_ticks(const uint8_t * const page, const uint16_t size) {
+      if (size < 4) return 0;
+
+      const uint16_t ticks = page[0] | (page[1] << 8),
+                     motors = page[2] | (page[3] << 8);
+      if (!ticks || !motors || (motors & ~QS_MOTORS_AVAILABLE)) return 0;
+
+      uint16_t i = 4;
+      for (uint8_t m = 0; m < QS_MOTORS; ++m) {
+        if (!TEST(motors, m)) continue;
+        if (i >= size) return 0;
+
+        const uint8_t n = page[i++];
+        if (!n || i + n * QS_RECORD_SIZE > size) return 0;
+
+        // Every interval must stay in range and all steps must land within the page
+        uint32_t motor_ticks = 0;
+        for (uint8_t r = 0; r < n; ++r, i += QS_RECORD_SIZE) {
+          const int32_t interval = page[i] | (page[i + 1] << 8),
+                        add = int16_t(page[i + 2] | (page[i + 3] << 8)),
+                        count = (page[i + 4] | (page[i + 5] << 8)) & 0x7FFF,
+                        last = interval + add * (count - 1);
+          if (!interval || !count || last < 1 || last > 0xFFFF) return 0;
+          motor_ticks += uint32_t(count) * (interval + last) / 2;
+          if (motor_ticks > ticks) return 0;
+        }
+      }
+
+      return ticks;
+    }
+
+  #endif
+
 };
 
 DirectStepping::PageManager page_manager;
@@ -257,6 +313,10 @@ const uint8_t segment_table[DirectStepping::Config::NUM_SEGMENTS][DirectStepping
 
     {0} // Uncompressed format, table not used
 
+  #elif STEPPER_PAGE_FORMAT == SP_QS_256
+
+    {0} // Record format, table not used
+
   #endif
 
 };
@@ -47,6 +47,63 @@ namespace DirectStepping {
     xyze_int_t bd;
   };
 
+  /**
+   * Queue-step pages (SP_QS_256) carry a variable set of motors. Little-endian layout:
+   *
+   *   uint16 ticks    : Page length in ticks of the G6 R / M722 step rate
+   *   uint16 motors   : Bitmask of QSMotor slots present in the page
+   *   Per motor, in slot order:
+   *     uint8 n       : Number of records
+   *     n * { uint16 interval, int16 add, uint16 count }
+   *
+   * Each record steps its motor 'count' times (bit 15 set = reverse), the first step
+   * 'interval' ticks after the record starts, adding 'add' to the interval after each step.
+   */
+  enum QSMotor : uint8_t {
+    QS_X, QS_Y, QS_Z, QS_Z2, QS_Z3, QS_Z4, QS_E0,
+    QS_MOTORS = QS_E0 + E_STEPPERS
+  };
+
+  constexpr uint8_t QS_RECORD_SIZE = 6;
+
+  // Motor slots present on this machine
+  constexpr uint16_t QS_MOTORS_AVAILABLE = _BV(QS_X)
+    | TERN0(HAS_Y_AXIS, _BV(QS_Y))
+    | TERN0(HAS_Z_AXIS, (_BV(NUM_Z_STEPPERS) - 1) << QS_Z)
+    | ((_BV(E_STEPPERS) - 1) << QS_E0);
+
+  struct qs_motor_t {
+    const uint8_t *rec; // Next record in the page
+    uint8_t left;       // Records not yet loaded
+    uint16_t count,     // Steps left in the current record
+             interval,  // Ticks between steps
+             wait;      // Ticks until the next step
+    int16_t add;        // Added to the interval after each step
+  };
+
+  struct qs_step_state_t {
+    uint16_t active,      // Motors with steps left in this page
+             reverse,     // Motors stepping in reverse
+             dir_pending, // Motors whose DIR pin changes after the current pulse
+             track;       // Motors counted into the stepper position
+    qs_motor_t motor[QS_MOTORS];
+  };
+
+  // Load a motor's next record and return its direction (true = reverse)
+  FORCE_INLINE bool qs_load_record(qs_motor_t &m) {
+    const uint8_t * const r = m.rec;
+    m.interval = r[0] | (r[1] << 8);
+    m.add = int16_t(r[2] | (r[3] << 8));
+    m.count = (r[4] | (r[5] << 8)) & 0x7FFF;
+    m.wait = m.interval;
+    m.rec += QS_RECORD_SIZE;
+    m.left--;
+    return TEST(r[5], 7);
+  }
+
+  // Validate a queue-step page and return its length in ticks, or 0 if it is malformed
+  uint16_t qs_page_ticks(const uint8_t * const page, const uint16_t size);
+
   template<typename Cfg>
   class SerialPageManager {
   public:
@@ -61,6 +118,11 @@ namespace DirectStepping {
     static uint8_t *get_page(const page_idx_t page_idx);
     static void free_page(const page_idx_t page_idx);
 
+    // Local page sources (e.g., M722 from SD) fill pages without the serial protocol
+    static bool claim_page(page_idx_t &page_idx);
+    static void commit_page(const page_idx_t page_idx);
+    static void set_local_source(const bool local) { local_source = local; }
+
   protected:
 
     typedef typename Cfg::write_byte_idx_t write_byte_idx_t;
@@ -70,6 +132,7 @@ namespace DirectStepping {
 
     static volatile PageState page_states[Cfg::PAGE_COUNT];
     static volatile bool page_states_dirty;
+    static bool local_source;
 
     static uint8_t pages[Cfg::PAGE_COUNT][Cfg::PAGE_SIZE];
     static uint8_t checksum;
@@ -108,6 +171,25 @@ namespace DirectStepping {
   template <uint8_t num_pages>
   using SP_4x1_512  = config_t<num_pages, 4, 1, false, 512>;
 
+  // Queue-step pages are sized per page, and their tick count comes from the page header
+  template <int num_pages>
+  struct qs_config_t {
+    static constexpr char CONTROL_CHAR  = '!';
+
+    static constexpr int PAGE_COUNT     = num_pages;
+    static constexpr int DIRECTIONAL    = 0;
+    static constexpr int NUM_SEGMENTS   = 1;
+    static constexpr int SEGMENT_STEPS  = 1;
+    static constexpr int TOTAL_STEPS    = 0;
+    static constexpr int PAGE_SIZE      = 256;
+
+    typedef uvalue_t(PAGE_SIZE - 1) write_byte_idx_t;
+    typedef uvalue_t(PAGE_COUNT - 1) page_idx_t;
+  };
+
+  template <uint8_t num_pages>
+  using SP_QS_256   = qs_config_t<num_pages>;
+
   // configured types
   typedef STEPPER_PAGE_FORMAT<STEPPER_PAGES> Config;
 
@@ -120,6 +202,16 @@ namespace DirectStepping {
 //#define SP_4x2D_256 3
 #define SP_4x2_256 4
 #define SP_4x1_512 5
+#define SP_QS_256 6
+
+#if STEPPER_PAGE_FORMAT == SP_QS_256
+  #define HAS_QS_STEP_PAGES 1
+  #if ANY(SWITCHING_EXTRUDER, MIXING_EXTRUDER, E_DUAL_STEPPER_DRIVERS)
+    #error "STEPPER_PAGE_FORMAT SP_QS_256 requires one E stepper per extruder."
+  #endif
+#elif ENABLED(DIRECT_STEPPING_SD)
+  #error "DIRECT_STEPPING_SD requires STEPPER_PAGE_FORMAT SP_QS_256."
+#endif
 
 typedef typename DirectStepping::Config::page_idx_t page_idx_t;
 
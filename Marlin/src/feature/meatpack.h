@@ -134,6 +134,7 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   uint8_t readIndex;
 
   NO_INLINE void write(uint8_t c)     { out.write(c); }
+  void write(const uint8_t *buffer, size_t size) { serial_write_block(out, buffer, size); }
   void flush()                        { out.flush();  }
   void begin(long br)                 { out.begin(br); readIndex = 0; }
   void end()                          { out.end(); }
@@ -53,6 +53,15 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::ui_flag_resume; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint8_t PrintJobRecovery::block_extruder;
+  plr_journal_record_t PrintJobRecovery::journal_next;
+  bool PrintJobRecovery::journal_pending;
+  uint16_t PrintJobRecovery::journal_seq;
+  uint8_t PrintJobRecovery::journal_commands;
+  millis_t PrintJobRecovery::journal_next_ms;
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -99,7 +108,10 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { info = {}; }
+void PrintJobRecovery::init() {
+  info = {};
+  TERN_(POWER_LOSS_JOURNAL, journal_pending = false);
+}
 
 /**
  * Enable or disable then call changed()
@@ -156,6 +168,7 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    TERN_(POWER_LOSS_JOURNAL, journal_replay());
     close();
   }
   debug(F("Load"));
@@ -176,6 +189,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
   // We don't check isStillPrinting here so a save may occur during a pause
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Between snapshots only the moving state is captured, for the idle loop to write
+    if (!force) return journal_capture();
+  #endif
+
   #if SAVE_INFO_INTERVAL_MS > 0
     static millis_t next_save_ms; // = 0
     millis_t ms = millis();
@@ -247,6 +265,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
     TERN_(GRADIENT_MIX, memcpy(&info.gradient, &mixer.gradient, sizeof(info.gradient)));
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      journal_track();
+      TERN_(MIXING_EXTRUDER, info.selected_vtool = mixer.get_current_vtool());
+    #endif
+
     #if ENABLED(FWRETRACT)
       COPY(info.retract, fwretract.current_retract);
       info.retract_hop = fwretract.current_hop;
@@ -359,13 +382,133 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // A new snapshot starts a new journal. Older records no longer match its epoch.
+    ++info.journal_epoch;
+    journal_seq = 0;
+    journal_pending = false;
+
+    // The file stays open for the journal records that follow
+    open(false);
+    bool ok = file.seekSet(0) && file.write(&info, sizeof(info)) == int16_t(sizeof(info));
+
+    // Reserve the whole journal once so records never change the file size
+    if (ok && file.fileSize() < journal_offset(POWER_LOSS_JOURNAL_RECORDS)) {
+      const plr_journal_record_t blank{};
+      for (uint16_t i = 0; ok && i < POWER_LOSS_JOURNAL_RECORDS; ++i)
+        ok = file.write(&blank, sizeof(blank)) == int16_t(sizeof(blank));
+    }
+
+    if (!ok) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.sync()) DEBUG_ECHOLNPGM("Power-loss file sync failed.");
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  static uint8_t journal_check(const plr_journal_record_t &r) {
+    const uint8_t * const p = (const uint8_t*)&r;
+    uint8_t sum = 1;
+    for (uint8_t i = 0; i < offsetof(plr_journal_record_t, check); ++i) sum += p[i];
+    return sum;
+  }
+
+  /**
+   * Update the last position of the tool running the current move.
+   * The Stepper ISR fills these fields at the start of each move.
+   */
+  void PrintJobRecovery::journal_track() {
+    hal.isr_off();
+    const uint8_t e = block_extruder;
+    const xyze_pos_t pos = info.current_position;
+    hal.isr_on();
+    info.tool_z[e] = pos.z;
+    info.tool_e[e] = pos.e;
+  }
+
+  /**
+   * Capture the moving state every few commands. Only the latest capture
+   * is kept, so this never waits on the media.
+   */
+  void PrintJobRecovery::journal_capture() {
+    if (++journal_commands < POWER_LOSS_JOURNAL_COMMANDS) return;
+    journal_commands = 0;
+
+    journal_track();
+
+    plr_journal_record_t &r = journal_next;
+    r.sdpos = info.sdpos;
+    r.xy = info.current_position;
+    COPY(r.z, info.tool_z);
+    COPY(r.e, info.tool_e);
+    r.active_extruder = block_extruder;
+    TERN_(MIXING_EXTRUDER, r.selected_vtool = mixer.get_current_vtool());
+    journal_pending = true;
+  }
+
+  /**
+   * Append the latest capture to the journal, at most every POWER_LOSS_JOURNAL_MS.
+   * A full journal is compacted into a new snapshot.
+   */
+  void PrintJobRecovery::journal_idle() {
+    if (!journal_pending || !enabled) return;
+    const millis_t ms = millis();
+    if (PENDING(ms, journal_next_ms)) return;
+    journal_next_ms = ms + POWER_LOSS_JOURNAL_MS;
+
+    if (journal_seq >= POWER_LOSS_JOURNAL_RECORDS) return save(true);
+
+    journal_pending = false;
+
+    plr_journal_record_t &r = journal_next;
+    r.epoch = info.journal_epoch;
+    r.seq = journal_seq;
+    r.check = journal_check(r);
+
+    open(false);
+    if (file.seekSet(journal_offset(journal_seq)) && file.write(&r, sizeof(r)) == int16_t(sizeof(r)) && file.sync())
+      ++journal_seq;
+    else
+      DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+  }
+
+  /**
+   * Apply the journal records that follow the snapshot just read,
+   * stopping at the first one that is torn or from an older epoch.
+   */
+  void PrintJobRecovery::journal_replay() {
+    journal_seq = 0;
+    if (!info.valid()) return;
+    plr_journal_record_t r;
+    while (journal_seq < POWER_LOSS_JOURNAL_RECORDS
+      && file.read(&r, sizeof(r)) == int16_t(sizeof(r))
+      && r.check == journal_check(r) && r.epoch == info.journal_epoch && r.seq == journal_seq
+    ) {
+      const uint8_t e = r.active_extruder;
+      if (e >= EXTRUDERS) break;
+      info.sdpos = r.sdpos;
+      info.current_position.set(r.xy.x, r.xy.y, r.z[e]);
+      info.current_position.e = r.e[e];
+      COPY(info.tool_z, r.z);
+      COPY(info.tool_e, r.e);
+      E_TERN_(info.active_extruder = e);
+      TERN_(MIXING_EXTRUDER, info.selected_vtool = r.selected_vtool);
+      ++journal_seq;
+    }
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -521,6 +664,11 @@ void PrintJobRecovery::resume() {
     PROCESS_SUBCOMMANDS_NOW(TS('T', info.active_extruder, 'S'));
   #endif
 
+  // Restore the mixing virtual tool
+  #if ALL(MIXING_EXTRUDER, POWER_LOSS_JOURNAL)
+    PROCESS_SUBCOMMANDS_NOW(TS('T', info.selected_vtool));
+  #endif
+
   // Restore print cooling fan speeds
   #if HAS_FAN
     FANS_LOOP(i) {
@@ -656,6 +804,11 @@ void PrintJobRecovery::resume() {
           DEBUG_ECHOLNPGM("active_extruder: ", info.active_extruder);
         #endif
 
+        #if ENABLED(POWER_LOSS_JOURNAL)
+          DEBUG_ECHOLNPGM("journal_epoch: ", info.journal_epoch, " records: ", journal_seq);
+          EXTRUDER_LOOP() DEBUG_ECHOLNPGM("T", e, " Z", info.tool_z[e], " E", info.tool_e[e]);
+        #endif
+
         #if DISABLED(NO_VOLUMETRICS)
           DEBUG_ECHOPGM("filament_size:");
           EXTRUDER_LOOP() DEBUG_ECHOLNPGM(" ", info.filament_size[e]);
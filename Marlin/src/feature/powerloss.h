@@ -57,6 +57,25 @@
 //#define SAVE_EACH_CMD_MODE
 //#define SAVE_INFO_INTERVAL_MS 0
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  /**
+   * The moving state, appended to the recovery file after a full snapshot.
+   * Records of an older snapshot are told apart by their epoch.
+   */
+  typedef struct {
+    uint16_t epoch;                       // Journal epoch of the snapshot this record follows
+    uint16_t seq;                         // Index of this record in the journal
+    uint32_t sdpos;                       // File position of the running command
+    xy_pos_t xy;
+    float z[EXTRUDERS], e[EXTRUDERS];     // Each tool's Z and E when last used
+    uint8_t active_extruder;
+    #if ENABLED(MIXING_EXTRUDER)
+      uint8_t selected_vtool;
+    #endif
+    uint8_t check;                        // One plus the sum of the bytes above
+  } plr_journal_record_t;
+#endif
+
 typedef struct {
   uint8_t valid_head;
 
@@ -113,8 +132,17 @@ typedef struct {
     float retract[EXTRUDERS], retract_hop;
   #endif
 
+  // Journal epoch and the position of each syringe
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    uint16_t journal_epoch;
+    float tool_z[EXTRUDERS], tool_e[EXTRUDERS];
+  #endif
+
   // Mixing extruder and gradient
   #if ENABLED(MIXING_EXTRUDER)
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      uint8_t selected_vtool;
+    #endif
     //uint_fast8_t selected_vtool;
     //mixer_comp_t color[NR_MIXING_VIRTUAL_TOOLS][MIXING_STEPPERS];
     #if ENABLED(GRADIENT_MIX)
@@ -166,6 +194,11 @@ class PrintJobRecovery {
       static bool ui_flag_resume;     //!< Flag the UI to show a dialog to Resume (M1000) or Cancel (M1000C)
     #endif
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint8_t block_extruder;  //!< Tool of the running move, set by the Stepper ISR
+      static void journal_idle();     //!< Write the latest capture to the journal
+    #endif
+
     static void init();
     static void prepare();
 
@@ -236,6 +269,19 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static plr_journal_record_t journal_next; //!< Latest capture, waiting to be written
+      static bool journal_pending;
+      static uint16_t journal_seq;              //!< Index of the next record in the file
+      static uint8_t journal_commands;          //!< Saves since the last capture
+      static millis_t journal_next_ms;
+
+      static uint32_t journal_offset(const uint16_t i) { return sizeof(job_recovery_info_t) + uint32_t(i) * sizeof(plr_journal_record_t); }
+      static void journal_track();
+      static void journal_capture();
+      static void journal_replay();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
@@ -0,0 +1,514 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/preflight.cpp - Background pre-flight scan of a media file
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PREFLIGHT_SCAN)
+
+#include "preflight.h"
+#include "../gcode/gcode.h"
+#include "../module/planner.h"
+#include "../module/motion.h"
+#include "../libs/crc16.h"
+
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #include "syringe_flow.h"
+#endif
+
+#define HAS_PREFLIGHT_ETA ALL(HAS_PRINT_PROGRESS, SET_REMAINING_TIME)
+#if HAS_PREFLIGHT_ETA
+  #include "../lcd/marlinui.h"
+#endif
+
+#define PREFLIGHT_MAGIC 0x324C4650UL // "PFL2"
+
+Preflight preflight;
+
+preflight_result_t Preflight::result;
+bool Preflight::valid;
+char Preflight::name[FILENAME_LENGTH];
+MediaFile Preflight::folder, Preflight::file;
+
+// Parser and motion model state for the file being scanned
+static struct {
+  char line[MAX_CMD_SIZE];
+  uint8_t len;
+  char comment;                     // ';' or '(' while inside a comment
+  bool rel_xyz, rel_e;              // G91 / M83
+  uint8_t tool;
+  xyz_pos_t pos;
+  float e,                          // Logical E, for absolute E moves
+        e_out[EXTRUDERS],           // (mm) E pushed out by each tool since the start
+        feedrate;                   // (mm/s)
+  bool bounded;                     // The bounds hold a printing move
+  uint8_t next_mark;
+
+  // The last move waits for the next one to set its exit speed
+  float pend_mm, pend_v, pend_a, pend_vi;
+  xyze_float_t pend_dir;
+} scan;
+
+//
+// Time the pending move to leave at vf (or less, if it can't reach vf) and
+// return the exit speed. A trapezoid as in the planner. The entry speed is
+// already spent, so a move too short to slow down to vf is timed from the
+// highest entry it could have had, as the planner's reverse pass would do.
+//
+static float scan_flush(float vf=0) {
+  if (!scan.pend_mm) return 0;
+
+  const float L = scan.pend_mm, v = scan.pend_v, a = scan.pend_a;
+  float vi = scan.pend_vi;
+  NOMORE(vf, SQRT(sq(vi) + 2 * a * L));
+  NOMORE(vi, SQRT(sq(vf) + 2 * a * L));
+
+  const float accel_mm = (sq(v) - sq(vi)) / (2 * a),
+              decel_mm = (sq(v) - sq(vf)) / (2 * a);
+  float t;
+  if (accel_mm + decel_mm <= L)
+    t = (2 * v - vi - vf) / a + (L - accel_mm - decel_mm) / v;
+  else {
+    // No cruise. Peak where the accel and decel ramps meet.
+    const float vp = SQRT(a * L + 0.5f * (sq(vi) + sq(vf)));
+    t = vp > _MAX(vi, vf) ? (2 * vp - vi - vf) / a : 2 * L / (vi + vf);
+  }
+
+  Preflight::result.seconds += t;
+  scan.pend_mm = 0;
+  return vf;
+}
+
+//
+// Add a move to the model. Arcs pass their length in arc_mm.
+//
+static void scan_move(const xyz_pos_t &to, const_float_t de, const_float_t arc_mm=0) {
+  const xyz_float_t d = to - scan.pos;
+  const float xyz_mm = arc_mm ?: d.magnitude(),
+              mm = xyz_mm ?: ABS(de);
+
+  if (de) {
+    const uint8_t t = scan.tool;
+    scan.e_out[t] += de;
+    NOLESS(Preflight::result.e_mm[t], scan.e_out[t]);
+  }
+
+  // Bounds of printing moves
+  if (de > 0 && xyz_mm) {
+    preflight_result_t &r = Preflight::result;
+    if (!scan.bounded) { r.min = r.max = scan.pos; scan.bounded = true; }
+    LOOP_NUM_AXES(i) {
+      NOMORE(r.min[i], _MIN(scan.pos[i], to[i]));
+      NOLESS(r.max[i], _MAX(scan.pos[i], to[i]));
+    }
+  }
+
+  scan.pos = to;
+  if (mm < 0.0001f) return;
+
+  // Planner limits for each axis by its share of the move
+  const float inv_mm = 1.0f / mm;
+  xyze_float_t unit;
+  unit.set(d * inv_mm);
+  unit.e = de * inv_mm;
+
+  const planner_settings_t &s = planner.settings;
+  float v = scan.feedrate,
+        a = de ? (xyz_mm ? s.acceleration : s.retract_acceleration) : s.travel_acceleration;
+  LOOP_NUM_AXES(i) if (unit[i]) {
+    NOMORE(v, s.max_feedrate_mm_s[i] / ABS(unit[i]));
+    NOMORE(a, s.max_acceleration_mm_per_s2[i] / ABS(unit[i]));
+  }
+  if (unit.e) {
+    const AxisEnum ea = E_AXIS_N(scan.tool);
+    NOMORE(v, s.max_feedrate_mm_s[ea] / ABS(unit.e));
+    NOMORE(a, s.max_acceleration_mm_per_s2[ea] / ABS(unit.e));
+  }
+  NOLESS(a, 1.0f);
+
+  // Direction through corners: XYZ, or E for an E-only move
+  xyze_float_t dir = unit;
+  if (xyz_mm) dir.e = 0; else dir.e = SIGN(de);
+
+  // Highest speed through the corner from the pending move
+  float vj = 0;
+  if (scan.pend_mm) {
+    const float cos_theta = -(scan.pend_dir.x * dir.x + scan.pend_dir.y * dir.y + scan.pend_dir.z * dir.z + scan.pend_dir.e * dir.e);
+    vj = _MIN(scan.pend_v, v);
+    #if HAS_JUNCTION_DEVIATION
+      if (cos_theta > 0.999999f)
+        vj = 0;
+      else if (cos_theta > -0.999999f) {
+        const float sin_theta_d2 = SQRT(0.5f * (1.0f - cos_theta));
+        NOMORE(vj, SQRT(a * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2)));
+      }
+    #elif HAS_CLASSIC_JERK
+      const float turn = SQRT(2.0f * (1.0f + cos_theta));
+      if (turn > 0.0001f) NOMORE(vj, planner.max_jerk.x / turn);
+    #endif
+  }
+
+  const float vi = scan_flush(vj);
+  scan.pend_mm = mm;
+  scan.pend_v = v;
+  scan.pend_a = a;
+  scan.pend_vi = vi;
+  scan.pend_dir = dir;
+}
+
+// Find a parameter word in the arguments
+static bool scan_word(const char * const args, const char c, float &v) {
+  const char * const p = strchr(args, c);
+  if (!p) return false;
+  v = strtof(p + 1, nullptr);
+  return true;
+}
+
+// Get the target and E distance of a move
+static float scan_target(const char * const args, xyz_pos_t &to) {
+  float v;
+  to = scan.pos;
+  LOOP_NUM_AXES(i) if (scan_word(args, AXIS_CHAR(i), v)) to[i] = scan.rel_xyz ? to[i] + v : v;
+  if (scan_word(args, 'F', v) && v > 0) scan.feedrate = MMM_TO_MMS(v);
+  if (!scan_word(args, 'E', v)) return 0;
+  const float de = scan.rel_e ? v : v - scan.e;
+  scan.e += de;
+  return de;
+}
+
+// G2 / G3 as one move along the arc
+static void scan_arc(const char * const args, const bool ccw) {
+  xyz_pos_t to;
+  const float de = scan_target(args, to);
+  const xy_float_t chord = to - scan.pos;
+  float r, angle;
+
+  if (scan_word(args, 'R', r)) {
+    const float c = chord.magnitude();
+    angle = c < 2 * ABS(r) ? 2 * asinf(c / (2 * ABS(r))) : float(M_PI);
+    if (r < 0) angle = 2 * float(M_PI) - angle;
+  }
+  else {
+    xy_float_t ij;
+    ij.reset();
+    scan_word(args, 'I', ij.x);
+    scan_word(args, 'J', ij.y);
+    const xy_float_t from = -ij, rel = chord - ij;
+    angle = ATAN2(from.x * rel.y - from.y * rel.x, from.x * rel.x + from.y * rel.y);
+    if (!ccw) angle = -angle;
+    if (angle <= 0.0001f) angle += 2 * float(M_PI);
+    r = ij.magnitude();
+  }
+
+  const float arc_mm = HYPOT(ABS(r) * angle, to.z - scan.pos.z);
+  scan_move(to, de, arc_mm ?: 0.0001f);
+}
+
+static void scan_line() {
+  const char *p = scan.line;
+  while (*p == ' ') p++;
+  if (*p == 'N') {                  // Skip a line number
+    p++;
+    while (NUMERIC_SIGNED(*p)) p++;
+    while (*p == ' ') p++;
+  }
+
+  const char letter = *p++;
+  if (!NUMERIC(*p)) return;
+  char *args;
+  const long code = strtol(p, &args, 10);
+
+  float v;
+  switch (letter) {
+    case 'G': switch (code) {
+      case 0: case 1: {
+        xyz_pos_t to;
+        const float de = scan_target(args, to);
+        scan_move(to, de);
+      } break;
+
+      case 2: case 3: scan_arc(args, code == 3); break;
+
+      case 4:
+        scan_flush();
+        if (scan_word(args, 'S', v)) Preflight::result.seconds += v;
+        else if (scan_word(args, 'P', v)) Preflight::result.seconds += v * 0.001f;
+        break;
+
+      case 28: {
+        scan_flush();
+        const bool all = !strpbrk(args, "XYZ");
+        LOOP_NUM_AXES(i) if (all || strchr(args, AXIS_CHAR(i))) scan.pos[i] = base_home_pos((AxisEnum)i);
+      } break;
+
+      case 90: scan.rel_xyz = scan.rel_e = false; break;
+      case 91: scan.rel_xyz = scan.rel_e = true; break;
+
+      case 92:
+        LOOP_NUM_AXES(i) if (scan_word(args, AXIS_CHAR(i), v)) scan.pos[i] = v;
+        if (scan_word(args, 'E', v)) scan.e = v;
+        break;
+    } break;
+
+    case 'M': switch (code) {
+      case 82: scan.rel_e = false; break;
+      case 83: scan.rel_e = true; break;
+      case 400: scan_flush(); break;
+    } break;
+
+    case 'T':
+      if (code < EXTRUDERS && code != scan.tool) {
+        scan_flush();
+        scan.tool = code;
+        Preflight::result.toolchanges++;
+      }
+      break;
+  }
+}
+
+//
+// Feed one character to the line buffer and the line end to the parser
+//
+static void scan_char(const char c, const uint32_t pos) {
+  if (c == '\n' || c == '\r') {
+    if (scan.len) {
+      scan.line[scan.len] = '\0';
+      scan_line();
+    }
+    scan.len = 0;
+    scan.comment = 0;
+
+    // Note the time at the end of each part of the file
+    preflight_result_t &r = Preflight::result;
+    while (scan.next_mark < PREFLIGHT_MARKS && uint64_t(pos) * PREFLIGHT_MARKS >= uint64_t(scan.next_mark + 1) * r.filesize)
+      r.mark_s[scan.next_mark++] = r.seconds;
+    return;
+  }
+
+  if (scan.comment) {
+    if (scan.comment == '(' && c == ')') scan.comment = 0;
+  }
+  else if (c == ';' || c == '(')
+    scan.comment = c;
+  else if (c == '*')                // Checksum
+    scan.comment = ';';
+  else if (scan.len < sizeof(scan.line) - 1)
+    scan.line[scan.len++] = toupper(c);
+}
+
+float Preflight::volume(const uint8_t e, const_float_t mm) {
+  #if ENABLED(VOLUMETRIC_EXTRUSION)
+    if (parser.volumetric_enabled) return mm;
+  #endif
+  #if ENABLED(SYRINGE_FLOW_MODEL)
+    const float d = syringe_flow.volumetric_diameter(e, DEFAULT_NOMINAL_FILAMENT_DIA);
+  #else
+    UNUSED(e);
+    constexpr float d = DEFAULT_NOMINAL_FILAMENT_DIA;
+  #endif
+  return mm * float(M_PI) * 0.25f * sq(d);
+}
+
+void Preflight::sidecar_name(char * const out) {
+  strcpy(out, name);
+  char * const dot = strchr(out, '.');
+  strcpy(dot ?: out + strlen(out), ".PFL");
+}
+
+// Fill in the identity of the file and the planner limits to scan it with
+static void set_key(preflight_result_t &r, MediaFile &f, const char * const fname) {
+  strcpy(r.fname, fname);
+  r.filesize = f.fileSize();
+  dir_t d;
+  if (f.dirEntry(&d)) { r.write_date = d.lastWriteDate; r.write_time = d.lastWriteTime; }
+
+  const planner_settings_t &s = planner.settings;
+  uint16_t crc = 0;
+  crc16(&crc, &s.max_acceleration_mm_per_s2, sizeof(s.max_acceleration_mm_per_s2));
+  crc16(&crc, &s.max_feedrate_mm_s, sizeof(s.max_feedrate_mm_s));
+  crc16(&crc, &s.acceleration, sizeof(s.acceleration));
+  crc16(&crc, &s.retract_acceleration, sizeof(s.retract_acceleration));
+  crc16(&crc, &s.travel_acceleration, sizeof(s.travel_acceleration));
+  #if HAS_JUNCTION_DEVIATION
+    crc16(&crc, &planner.junction_deviation_mm, sizeof(planner.junction_deviation_mm));
+  #elif HAS_CLASSIC_JERK
+    crc16(&crc, &planner.max_jerk, sizeof(planner.max_jerk));
+  #endif
+  r.limits_crc = crc;
+}
+
+bool Preflight::load_sidecar() {
+  char sname[FILENAME_LENGTH];
+  sidecar_name(sname);
+  MediaFile side;
+  if (!side.open(&folder, sname, O_READ)) return false;
+
+  preflight_result_t key{};
+  set_key(key, file, name);
+
+  uint32_t magic = 0;
+  uint16_t crc = 0, check = 0;
+  const bool ok = side.read(&magic, sizeof(magic)) == int16_t(sizeof(magic))
+               && side.read(&result, sizeof(result)) == int16_t(sizeof(result))
+               && side.read(&check, sizeof(check)) == int16_t(sizeof(check));
+  side.close();
+  if (!ok || magic != PREFLIGHT_MAGIC) return false;
+
+  crc16(&crc, &result, sizeof(result));
+  return crc == check
+      && !strcmp(result.fname, key.fname)
+      && result.filesize == key.filesize
+      && result.write_date == key.write_date && result.write_time == key.write_time
+      && result.limits_crc == key.limits_crc;
+}
+
+void Preflight::save_sidecar() {
+  #if DISABLED(SDCARD_READONLY)
+    char sname[FILENAME_LENGTH];
+    sidecar_name(sname);
+    MediaFile side;
+    if (!side.open(&folder, sname, O_CREAT | O_WRITE | O_TRUNC)) return;
+
+    const uint32_t magic = PREFLIGHT_MAGIC;
+    uint16_t crc = 0;
+    crc16(&crc, &result, sizeof(result));
+    side.write(&magic, sizeof(magic));
+    side.write(&result, sizeof(result));
+    side.write(&crc, sizeof(crc));
+    side.close();
+  #endif
+}
+
+bool Preflight::start(MediaFile &dir, const char * const fname, const bool use_sidecar/*=true*/) {
+  abort();
+  valid = false;
+  folder = dir;
+  if (!file.open(&folder, fname, O_READ)) return false;
+  file.getDosName(name);
+
+  if (use_sidecar && load_sidecar()) {
+    file.close();
+    valid = true;
+    return true;
+  }
+
+  // Start from the current modes, as a print would
+  result = {};
+  set_key(result, file, name);
+  scan = {};
+  scan.rel_xyz = gcode.axis_is_relative(X_AXIS);
+  scan.rel_e = gcode.axis_is_relative(E_AXIS);
+  scan.tool = active_extruder;
+  scan.feedrate = feedrate_mm_s;
+  return true;
+}
+
+void Preflight::select(const char * const path) {
+  const char * const slash = strrchr(path, '/');
+  if (start(card.getWorkDir(), slash ? slash + 1 : path)) report();
+}
+
+void Preflight::abort() {
+  if (file.isOpen()) file.close();
+}
+
+void Preflight::finish() {
+  scan_flush();
+  for (; scan.next_mark < PREFLIGHT_MARKS; ++scan.next_mark) result.mark_s[scan.next_mark] = result.seconds;
+  file.close();
+  valid = true;
+  save_sidecar();
+  report();
+}
+
+void Preflight::idle() {
+  if (scanning()) {
+    if (!card.isMounted()) return abort();
+
+    // Yield to a media print until its planner queue is at least half full,
+    // then only read one buffer per loop so the print keeps the media
+    const bool printing = card.isStillPrinting();
+    if (!printing || planner.movesplanned() >= planner.moves_free()) {
+      uint8_t buf[64];
+      const uint16_t bytes = printing ? sizeof(buf) : PREFLIGHT_SCAN_BYTES;
+      for (uint16_t n = 0; n < bytes; n += sizeof(buf)) {
+        const uint32_t at = file.curPosition();
+        const int16_t got = file.read(buf, sizeof(buf));
+        if (got <= 0) return finish();
+        for (int16_t i = 0; i < got; ++i) scan_char(buf[i], at + i + 1);
+      }
+    }
+  }
+
+  #if HAS_PREFLIGHT_ETA
+    // Keep the remaining time up to date, unless the host or the file sets it
+    static millis_t next_eta_ms;
+    static uint32_t eta_s;
+    const millis_t ms = millis();
+    if (card.isStillPrinting() && ELAPSED(ms, next_eta_ms) && (!ui.remaining_time || ui.remaining_time == eta_s)) {
+      next_eta_ms = ms + 5000UL;
+      const int32_t s = remaining_time();
+      if (s >= 0) ui.set_remaining_time(eta_s = s);
+    }
+  #endif
+}
+
+int32_t Preflight::remaining_time() {
+  if (!valid || !card.isFileOpen() || card.getFileSize() != result.filesize || !result.filesize) return -1;
+
+  // Interpolate the time taken to reach the file position
+  const float f = float(card.getIndex()) * PREFLIGHT_MARKS / result.filesize;
+  const uint8_t i = _MIN(uint8_t(f), PREFLIGHT_MARKS - 1);
+  const float t0 = i ? result.mark_s[i - 1] : 0,
+              done = t0 + (result.mark_s[i] - t0) * _MIN(f - i, 1.0f);
+
+  return _MAX(0L, LROUND((result.seconds - done) * 100 / _MAX(feedrate_percentage, int16_t(1))));
+}
+
+void Preflight::report() {
+  if (scanning()) {
+    SERIAL_ECHO_MSG("Preflight ", name, " scanning ", percent(), "%");
+    return;
+  }
+  if (!valid) {
+    SERIAL_ECHO_MSG("Preflight none");
+    return;
+  }
+
+  SERIAL_ECHO_MSG("Preflight ", name, " Time:", LROUND(result.seconds), "s Toolchanges:", result.toolchanges);
+  EXTRUDER_LOOP()
+    SERIAL_ECHO_MSG("Preflight T", e, " E:", p_float_t(result.e_mm[e], 2), " V:", p_float_t(volume(e, result.e_mm[e]), 1));
+  SERIAL_ECHO_MSG("Preflight Min"
+    " X:", p_float_t(result.min.x, 2), " Y:", p_float_t(result.min.y, 2), " Z:", p_float_t(result.min.z, 2),
+    " Max X:", p_float_t(result.max.x, 2), " Y:", p_float_t(result.max.y, 2), " Z:", p_float_t(result.max.z, 2)
+  );
+}
+
+void Preflight::report_eta() {
+  const int32_t s = remaining_time();
+  if (s >= 0) SERIAL_ECHOLNPGM("Preflight remaining:", s, "s");
+}
+
+#endif // PREFLIGHT_SCAN
@@ -0,0 +1,98 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/preflight.h - Background pre-flight scan of a media file
+ *
+ * The idle loop reads the selected file a few bytes at a time through a
+ * small G-code parser and a one-move-lookahead trapezoid model using the
+ * planner's speed and acceleration limits. Nothing moves. The result holds
+ * the syringe travel each tool needs, the print time and bounds, and is
+ * cached in a sidecar file (same 8.3 name, ".PFL") for the next M23, and
+ * only reused for the same file, write stamp and planner limits.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PREFLIGHT_SCAN)
+
+#include "../sd/cardreader.h"
+
+#ifndef PREFLIGHT_SCAN_BYTES
+  #define PREFLIGHT_SCAN_BYTES 512
+#endif
+#ifndef PREFLIGHT_MARKS
+  #define PREFLIGHT_MARKS 32
+#endif
+
+typedef struct {
+  char fname[FILENAME_LENGTH];      // 8.3 name of the scanned file. Files differing by extension share a sidecar.
+  uint32_t filesize;                // Size of the scanned file, to spot a changed file
+  uint16_t write_date, write_time;  // Last write of the scanned file, from its directory entry
+  uint16_t limits_crc;              // CRC of the planner limits (M201 M203 M204 M205) the time is based on
+  float seconds;                    // (s) Estimated print time at 100% feedrate
+  float e_mm[EXTRUDERS];            // (mm) Most E each tool pushes out beyond its start
+  xyz_pos_t min, max;               // Bounds of the printing moves
+  uint16_t toolchanges;             // Tool changes to a different tool
+  float mark_s[PREFLIGHT_MARKS];    // (s) Time at the end of each part of the file
+} preflight_result_t;
+
+class Preflight {
+public:
+  static preflight_result_t result;
+  static bool valid;                // The result holds a finished scan
+  static char name[FILENAME_LENGTH]; // 8.3 name of the scanned file
+
+  // M23: Load the sidecar of the selected file or start scanning it
+  static void select(const char * const path);
+
+  // Scan a file in the given folder, or load its sidecar if allowed
+  static bool start(MediaFile &folder, const char * const fname, const bool use_sidecar=true);
+  static void abort();
+
+  static bool scanning() { return file.isOpen(); }
+  static uint8_t percent() { return file.fileSize() ? uint8_t(uint64_t(file.curPosition()) * 100 / file.fileSize()) : 0; }
+
+  // Main loop: Scan the next few bytes
+  static void idle();
+
+  // (s) Time left in the media print at the current feedrate, -1 if unknown
+  static int32_t remaining_time();
+
+  static void report();
+  static void report_eta();
+
+  // (mm³) Volume of E pushed out by tool e
+  static float volume(const uint8_t e, const_float_t mm);
+
+private:
+  static MediaFile folder, file;
+  static void finish();
+  static bool load_sidecar();
+  static void save_sidecar();
+  static void sidecar_name(char * const out);
+};
+
+extern Preflight preflight;
+
+#endif // PREFLIGHT_SCAN
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/syringe_flow.cpp - Per-syringe volumetric model with pressure advance
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_FLOW_MODEL)
+
+#include "syringe_flow.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+
+SyringeFlow syringe_flow;
+
+syringe_flow_settings_t SyringeFlow::settings[EXTRUDERS];
+float SyringeFlow::advance_time[EXTRUDERS];
+
+void SyringeFlow::reset() {
+  constexpr float syringe_id[] = SYRINGE_INNER_DIAMETER,
+                  tau[] = SYRINGE_PRESSURE_TAU;
+  constexpr uint8_t gauge[] = SYRINGE_NEEDLE_GAUGE;
+  EXTRUDER_LOOP() {
+    settings[e].syringe_id = syringe_id[ALIM(e, syringe_id)];
+    settings[e].needle_gauge = gauge[ALIM(e, gauge)];
+    settings[e].tau = tau[ALIM(e, tau)];
+  }
+}
+
+void SyringeFlow::apply(const uint8_t e) {
+  // The needle resistance, and so tau, goes with 1 / bore^4
+  const float bore = needle_id(settings[e].needle_gauge);
+  advance_time[e] = settings[e].tau * (bore ? sq(sq(needle_id(SYRINGE_TAU_GAUGE) / bore)) : 1.0f);
+
+  #if ENABLED(LIN_ADVANCE)
+    // Without DISTINCT_E_FACTORS the planner has a single K, which follows the active tool
+    if (ENABLED(DISTINCT_E_FACTORS) || e == active_extruder)
+      planner.set_advance_k(advance_time[e], e);
+  #endif
+  #if DISABLED(NO_VOLUMETRICS)
+    // In volumetric mode E is in mm³ and the barrel stands in for the M200 filament
+    planner.calculate_volumetric_multipliers();
+  #endif
+}
+
+// Nominal bore of blunt dispensing needles, 14G to 34G, in 0.01mm
+float SyringeFlow::needle_id(const uint8_t gauge) {
+  static const uint8_t bore[] PROGMEM = {
+    154, 136, 119, 107,  84,  69,  60,  51,  41,  33,  31,  // 14G - 24G
+     25,  24,  20,  18,  17,  15,  13,  10,   9,   6        // 25G - 34G
+  };
+  if (!WITHIN(gauge, 14, 14 + COUNT(bore) - 1)) return 0;
+  return pgm_read_byte(&bore[gauge - 14]) * 0.01f;
+}
+
+#endif // SYRINGE_FLOW_MODEL
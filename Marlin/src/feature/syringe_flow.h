@@ -0,0 +1,75 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/syringe_flow.h - Per-syringe volumetric model with pressure advance
+ *
+ * A syringe of viscous ink behaves like a first-order system: the pressure
+ * behind the needle (and so the flow out of it) lags the plunger with a time
+ * constant tau. Leading the plunger by tau * (E speed) cancels the lag while
+ * accelerating and pulls back by the same amount while decelerating, which is
+ * exactly the linear advance term with K = tau.
+ *
+ * The time constant is the product of the compliance of the ink column and the
+ * flow resistance of the needle, which goes with 1 / bore^4 (Hagen-Poiseuille).
+ * Tau is given for a needle of SYRINGE_TAU_GAUGE and scaled to the needle in use.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+typedef struct {
+  float   syringe_id;   // M718 D - (mm) Inner diameter of the syringe barrel, 0 to use the M200 diameter
+  uint8_t needle_gauge; // M718 B - Needle gauge (G), 0 to use tau as given
+  float   tau;          // M718 K - (s) Pressure time constant with a SYRINGE_TAU_GAUGE needle
+} syringe_flow_settings_t;
+
+#if ENABLED(SYRINGE_FLOW_MODEL)
+
+class SyringeFlow {
+public:
+  static syringe_flow_settings_t settings[EXTRUDERS];
+  static float advance_time[EXTRUDERS];   // (s) Tau scaled to the needle in use
+
+  SyringeFlow() { reset(); }
+
+  static void reset();
+
+  // Push the model of tool e into the planner
+  static void apply(const uint8_t e);
+  static void apply_all() { EXTRUDER_LOOP() apply(e); }
+
+  // (s) Advance time for the planner and FT Motion E trajectory
+  static float advance_tau(const uint8_t e) { return advance_time[e]; }
+
+  // (mm) Inner diameter of a blunt dispensing needle of the given gauge, 0 if unknown
+  static float needle_id(const uint8_t gauge);
+
+  // (mm) Diameter for volumetric extrusion, the barrel or else the M200 filament size
+  static float volumetric_diameter(const uint8_t e, const_float_t filament_size) {
+    return settings[e].syringe_id ?: filament_size;
+  }
+};
+
+extern SyringeFlow syringe_flow;
+
+#endif // SYRINGE_FLOW_MODEL
@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/syringe_zero.cpp - Syringe plunger auto-zero
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_AUTO_ZERO)
+
+#include "syringe_zero.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../MarlinCore.h"
+
+SyringeZero syringe_zero;
+
+feedRate_t SyringeZero::feedrate_mm_s = SYRINGE_ZERO_FEEDRATE;
+float SyringeZero::preload_mm = SYRINGE_ZERO_PRELOAD_MM,
+      SyringeZero::max_travel_mm = SYRINGE_ZERO_MAX_TRAVEL;
+int16_t SyringeZero::stall_threshold = SYRINGE_ZERO_STALL_SENSITIVITY;
+
+// The E driver classes are all TMC2209, which report the live load in SG_RESULT.
+// A stall is signaled when the load value drops to twice the threshold or lower.
+bool SyringeZero::stalled(const uint8_t e) {
+  #define _STALLED(N) case N: return stepperE##N.SG_RESULT() <= 2 * stepperE##N.homing_threshold();
+  switch (e) { REPEAT(E_STEPPERS, _STALLED) }
+  return false;
+}
+
+int16_t SyringeZero::set_threshold(const uint8_t e, const int16_t thrs) {
+  #define _SET_THRS(N) case N: { const int16_t old = stepperE##N.homing_threshold(); stepperE##N.homing_threshold(thrs); return old; }
+  switch (e) { REPEAT(E_STEPPERS, _SET_THRS) }
+  return 0;
+}
+
+bool SyringeZero::enable_stallguard(const uint8_t e) {
+  #define _ENABLE_SG(N) case N: return tmc_enable_stallguard(stepperE##N);
+  switch (e) { REPEAT(E_STEPPERS, _ENABLE_SG) }
+  return false;
+}
+
+void SyringeZero::disable_stallguard(const uint8_t e, const bool restore_stealth) {
+  #define _DISABLE_SG(N) case N: tmc_disable_stallguard(stepperE##N, restore_stealth); break;
+  switch (e) { REPEAT(E_STEPPERS, _DISABLE_SG) }
+}
+
+uint8_t SyringeZero::zero(const uint8_t syringes) {
+  const uint8_t mask = syringes & (_BV(E_STEPPERS) - 1);
+  if (!mask) return 0;
+
+  planner.synchronize();
+
+  int16_t old_thrs[E_STEPPERS];
+  bool stealth[E_STEPPERS];
+  for (uint8_t e = 0; e < E_STEPPERS; ++e) if (TEST(mask, e)) {
+    old_thrs[e] = set_threshold(e, stall_threshold);
+    stealth[e] = enable_stallguard(e);
+  }
+
+  stepper.enable_e_steppers();
+  stepper.set_separate_e_axes(mask);
+
+  // Drive all selected plungers toward their pistons in one move
+  current_position.e += max_travel_mm;
+  line_to_current_position(feedrate_mm_s);
+
+  // Drop each syringe out of the move as soon as its driver reports a stall.
+  // Skip the readings taken while the plungers accelerate from standstill.
+  const float start_e = current_position.e;
+  const millis_t guard_ms = millis() + SYRINGE_ZERO_GUARD_MS;
+  uint8_t contact = 0;
+  while (planner.busy()) {
+    idle();
+    if (PENDING(millis(), guard_ms)) continue;
+    for (uint8_t e = 0; e < E_STEPPERS; ++e) {
+      if (TEST(stepper.e_separate_mask, e) && stalled(e)) {
+        stepper.stop_e_stepper(e);
+        SBI(contact, e);
+      }
+    }
+    if (!stepper.e_separate_mask) { quickstop_stepper(); break; }
+  }
+  planner.synchronize();
+
+  // E after the approach, for the active syringe if it made no contact
+  const float end_e = current_position.e;
+
+  for (uint8_t e = 0; e < E_STEPPERS; ++e) if (TEST(mask, e)) {
+    disable_stallguard(e, stealth[e]);
+    set_threshold(e, old_thrs[e]);
+  }
+
+  // Back the plungers that touched their piston off by the preload
+  if (contact && preload_mm) {
+    stepper.set_separate_e_axes(contact);
+    current_position.e -= preload_mm;
+    line_to_current_position(feedrate_mm_s);
+    planner.synchronize();
+  }
+
+  stepper.set_separate_e_axes(0);
+
+  // E is the position of the active syringe. It starts from E0 if the syringe
+  // made contact, or else keeps the travel it made (none if it wasn't selected).
+  current_position.e = TEST(contact, active_extruder) ? 0 : TEST(mask, active_extruder) ? end_e : start_e;
+  planner.set_e_position_mm(current_position.e);
+
+  return contact;
+}
+
+#endif // SYRINGE_AUTO_ZERO
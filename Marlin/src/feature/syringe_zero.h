@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/syringe_zero.h - Syringe plunger auto-zero
+ *
+ * Drives the plungers of the selected syringes forward together, stops each
+ * one when its TMC driver reports a stall against the piston, backs it off by
+ * a preload distance and zeroes the E position.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class SyringeZero {
+public:
+  static feedRate_t feedrate_mm_s;  // Plunger approach speed
+  static float preload_mm,          // Back-off distance after contact
+               max_travel_mm;       // Give up on a syringe after this much travel
+  static int16_t stall_threshold;   // StallGuard threshold applied to the E drivers
+
+  // Zero the syringes in the given bit mask. Return the mask of syringes that made contact.
+  static uint8_t zero(const uint8_t syringes);
+
+private:
+  static bool stalled(const uint8_t e);
+  static int16_t set_threshold(const uint8_t e, const int16_t thrs);
+  static bool enable_stallguard(const uint8_t e);
+  static void disable_stallguard(const uint8_t e, const bool restore_stealth);
+};
+
+extern SyringeZero syringe_zero;
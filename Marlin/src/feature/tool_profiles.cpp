@@ -0,0 +1,121 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/tool_profiles.cpp - Per-tool motion profiles
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TOOL_MOTION_PROFILES)
+
+#include "tool_profiles.h"
+#include "../module/motion.h"
+
+ToolProfiles tool_profiles;
+
+tool_profile_t ToolProfiles::profile[EXTRUDERS];
+planner_rates_t ToolProfiles::rates[EXTRUDERS];
+
+void ToolProfiles::reset() {
+  EXTRUDER_LOOP() {
+    tool_profile_t &p = profile[e];
+    p.name[0] = '\0';
+    p.planner = planner.settings;
+    TERN_(_TP_ADVANCE_K, p.advance_K = planner.get_advance_k());
+  }
+  refresh();
+}
+
+void ToolProfiles::refresh() {
+  EXTRUDER_LOOP() calc(e);
+}
+
+void ToolProfiles::load(const uint8_t e) {
+  planner.settings = profile[e].planner;
+  TERN_(_TP_ADVANCE_K, planner.set_advance_k(profile[e].advance_K));
+  refresh();
+}
+
+void ToolProfiles::store(const uint8_t e) {
+  tool_profile_t &p = profile[e];
+  TERN_(_TP_ADVANCE_K, p.advance_K = planner.get_advance_k());
+  // The rates only need work if the settings were changed while the tool was active
+  if (memcmp(&p.planner, &planner.settings, sizeof(planner_settings_t))) {
+    p.planner = planner.settings;
+    calc(e);
+  }
+}
+
+void ToolProfiles::select(const uint8_t old_tool, const uint8_t new_tool) {
+  if (old_tool == new_tool) return;
+  store(old_tool);
+  apply(new_tool);
+}
+
+void ToolProfiles::copy(const uint8_t from, const uint8_t to) {
+  if (from == active_extruder) store(from);
+  profile[to].planner = profile[from].planner;
+  TERN_(_TP_ADVANCE_K, profile[to].advance_K = profile[from].advance_K);
+  rates[to] = rates[from];
+  if (to == active_extruder) apply(to);
+}
+
+void ToolProfiles::edit_begin(const uint8_t e) {
+  if (e == active_extruder) return;
+  planner.synchronize();
+  store(active_extruder);
+  apply(e);
+}
+
+void ToolProfiles::edit_end(const uint8_t e) {
+  if (e == active_extruder) return;
+  store(e);
+  apply(active_extruder);
+}
+
+// Zero steps/mm, speed or acceleration would divide by zero in the rates and the planner
+static bool usable(const planner_settings_t &s) {
+  LOOP_DISTINCT_AXES(i)
+    if (!(s.axis_steps_per_mm[i] > 0) || !(s.max_feedrate_mm_s[i] > 0) || !s.max_acceleration_mm_per_s2[i])
+      return false;
+  return s.acceleration > 0 && s.retract_acceleration > 0 && s.travel_acceleration > 0;
+}
+
+void ToolProfiles::validate() {
+  EXTRUDER_LOOP() if (!usable(profile[e].planner)) {
+    profile[e].planner = planner.settings;
+    SERIAL_ECHO_MSG("Tool ", e, " motion profile reset");
+  }
+}
+
+void ToolProfiles::apply(const uint8_t e) {
+  planner.apply_profile(profile[e].planner, rates[e]);
+  TERN_(_TP_ADVANCE_K, planner.set_advance_k(profile[e].advance_K));
+}
+
+void ToolProfiles::set_name(const uint8_t e, const char * const name) {
+  strncpy(profile[e].name, name, TOOL_PROFILE_NAME_LEN);
+  profile[e].name[TOOL_PROFILE_NAME_LEN] = '\0';
+}
+
+#endif // TOOL_MOTION_PROFILES
@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/tool_profiles.h - Per-tool motion profiles
+ *
+ * Each tool keeps its own planner settings (M92, M201, M203, M204, M205) and
+ * advance K (M900), along with the step rates derived from them. Commands that
+ * change these settings act on the active tool. A tool change stores the live
+ * settings back into the outgoing profile and swaps in the new tool's profile
+ * and rates as a whole, so nothing is recalculated between moves.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TOOL_MOTION_PROFILES)
+
+#include "../module/planner.h"
+
+#define TOOL_PROFILE_NAME_LEN 12
+
+// With SYRINGE_FLOW_MODEL the advance K comes from the syringe settings
+#if ENABLED(LIN_ADVANCE) && DISABLED(SYRINGE_FLOW_MODEL)
+  #define _TP_ADVANCE_K 1
+#endif
+
+typedef struct {
+  char name[TOOL_PROFILE_NAME_LEN + 1];   // M726 - Profile name, such as the ink in the syringe
+  planner_settings_t planner;             // M92 M201 M203 M204 M205 - Set while the tool is active
+  #if _TP_ADVANCE_K
+    float advance_K;                      // M900 K - Set while the tool is active
+  #endif
+} tool_profile_t;
+
+class ToolProfiles {
+public:
+  static tool_profile_t profile[EXTRUDERS];
+
+  // Give every tool the live settings
+  static void reset();
+
+  // Recalculate the rates of every profile, as after loading or M205 J
+  static void refresh();
+
+  // Make the profile of tool e the live settings
+  static void load(const uint8_t e);
+
+  // Keep the live settings in the profile of tool e
+  static void store(const uint8_t e);
+
+  // Tool change: Keep the outgoing tool's settings and swap in the new tool's
+  static void select(const uint8_t old_tool, const uint8_t new_tool);
+
+  // Copy a whole profile (but not its name) to another tool
+  static void copy(const uint8_t from, const uint8_t to);
+
+  // M726 T<tool> M<code>: Let a settings command act on the profile of a tool as if it were active
+  static void edit_begin(const uint8_t e);
+  static void edit_end(const uint8_t e);
+
+  // Give tools with unusable settings, as from a bad EEPROM, the live settings
+  static void validate();
+
+  static void set_name(const uint8_t e, const char * const name);
+
+private:
+  static planner_rates_t rates[EXTRUDERS];
+  static void apply(const uint8_t e);
+  static void calc(const uint8_t e) { planner.calc_rates(profile[e].planner, rates[e]); }
+};
+
+extern ToolProfiles tool_profiles;
+
+#endif // TOOL_MOTION_PROFILES
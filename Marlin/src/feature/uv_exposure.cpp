@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/uv_exposure.cpp - UV LED exposure head for photocrosslinking while printing
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(UV_EXPOSURE_HEAD)
+
+#include "uv_exposure.h"
+
+UVExposure uvExposure;
+
+bool UVExposure::enabled;
+float UVExposure::dose[UV_EXPOSURE_CHANNELS];
+uint8_t UVExposure::output[UV_EXPOSURE_CHANNELS];
+
+constexpr pin_t uv_pins[] = UV_EXPOSURE_PINS;
+static_assert(COUNT(uv_pins) == UV_EXPOSURE_CHANNELS, "UV_EXPOSURE_PINS must have UV_EXPOSURE_CHANNELS pins.");
+
+void UVExposure::init() {
+  for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c) {
+    pinMode(uv_pins[c], OUTPUT);
+    #ifdef UV_EXPOSURE_PWM_FREQ
+      hal.set_pwm_frequency(uv_pins[c], UV_EXPOSURE_PWM_FREQ);
+    #endif
+    set_pin(c, 0);
+  }
+  reset();
+}
+
+void UVExposure::reset() {
+  constexpr float dose_init[] = UV_EXPOSURE_DOSE;
+  for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c)
+    dose[c] = dose_init[ALIM(c, dose_init)];
+  enabled = false;
+}
+
+void UVExposure::set_pin(const uint8_t c, const uint8_t v) {
+  hal.set_pwm_duty(uv_pins[c], v, 255, ENABLED(UV_EXPOSURE_INVERT));
+}
+
+#endif // UV_EXPOSURE_HEAD
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/uv_exposure.h - UV LED exposure head for photocrosslinking while printing
+ *
+ * Each channel's power follows the nozzle speed the same way inline laser
+ * power follows the trapezoid: the planner stores the power for the move's
+ * nominal speed and the Stepper ISR scales it by the current step rate.
+ * The light dose per mm of strand stays constant through accel and decel.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(UV_EXPOSURE_HEAD)
+
+class UVExposure {
+public:
+  static bool enabled;                              // M723 S - Expose extruding moves
+  static float dose[UV_EXPOSURE_CHANNELS];          // M723 D - PWM counts per mm/s of nozzle speed
+
+  static void init();
+  static void reset();
+
+  // Power (0-255) for a move at the given nominal speed (mm/s)
+  static uint8_t power_for_speed(const uint8_t c, const_float_t mm_s) {
+    return enabled ? uint8_t(_MIN(dose[c] * mm_s, 255.0f)) : 0;
+  }
+
+  // Called by the Stepper ISR whenever the step rate changes
+  static void apply_rate(const uint8_t (&power)[UV_EXPOSURE_CHANNELS], const uint32_t step_rate, const uint32_t nominal_rate) {
+    for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c)
+      write(c, power[c] && nominal_rate ? uint8_t(_MIN(uint32_t(power[c]) * step_rate / nominal_rate, 255UL)) : 0);
+  }
+
+  static void off() { for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c) write(c, 0); }
+
+private:
+  static uint8_t output[UV_EXPOSURE_CHANNELS];       // Last value written to each channel
+
+  static void write(const uint8_t c, const uint8_t v) {
+    if (v != output[c]) { output[c] = v; set_pin(c, v); }
+  }
+  static void set_pin(const uint8_t c, const uint8_t v);
+};
+
+extern UVExposure uvExposure;
+
+#endif // UV_EXPOSURE_HEAD
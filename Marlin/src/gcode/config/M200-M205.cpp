@@ -24,6 +24,10 @@
 #include "../../MarlinCore.h"
 #include "../../module/planner.h"
 
+#if ENABLED(TOOL_MOTION_PROFILES)
+  #include "../../feature/tool_profiles.h"
+#endif
+
 #if DISABLED(NO_VOLUMETRICS)
 
   /**
@@ -310,6 +314,8 @@ void GcodeSuite::M205() {
       if (WITHIN(junc_dev, 0.01f, 0.3f)) {
         planner.junction_deviation_mm = junc_dev;
         TERN_(HAS_LINEAR_E_JERK, planner.recalculate_max_e_jerk());
+        // The E jerk of every tool profile follows the junction deviation
+        TERN_(TOOL_MOTION_PROFILES, tool_profiles.refresh());
       }
       else
         SERIAL_ERROR_MSG("?J out of range (0.01 to 0.3)");
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(RUNTIME_BLOCK_BUFFER)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M720: Set the number of blocks in the planner ring
+ *
+ *   S<blocks> : Ring size, rounded down to a power of 2 and limited to
+ *               BLOCK_BUFFER_SIZE ... the pool size set by BLOCK_BUFFER_RAM_BUDGET (the default)
+ *
+ * A larger ring adds lookahead but takes longer to drain on pause / cancel.
+ * Waits for all queued moves to finish before resizing.
+ * With no parameters the current size is reported.
+ */
+void GcodeSuite::M720() {
+  if (!parser.seenval('S')) return M720_report(false);
+
+  block_index_t blocks = constrain(parser.value_ushort(), uint16_t(BLOCK_BUFFER_SIZE), uint16_t(block_pool_size));
+  while (!IS_POWER_OF_2(blocks)) blocks &= blocks - 1;   // Keep only the highest bit
+
+  planner.set_block_buffer_size(blocks);
+}
+
+void GcodeSuite::M720_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading_etc(forReplay, F("Planner Block Buffer"));
+  SERIAL_ECHOLNPGM("  M720 S", planner.block_buffer_size, " ; pool ", block_pool_size, " x ", uint16_t(sizeof(block_t)), " bytes");
+}
+
+#endif // RUNTIME_BLOCK_BUFFER
@@ -0,0 +1,149 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TOOL_MOTION_PROFILES)
+
+#include "../gcode.h"
+#include "../../feature/tool_profiles.h"
+#include "../../module/motion.h"
+
+/**
+ * M726: Name, copy, set, or report per-tool motion profiles
+ *
+ *   T<tool>  : Tool to change (Default: active tool)
+ *   C<tool>  : Copy the motion settings of another tool into this one
+ *   M<code>  : Apply an M92, M201, M203, M204, M205, or M900 command, given
+ *              with its parameters, to the profile of the tool
+ *   name     : Name the profile (up to 12 characters)
+ *
+ * T and C are parsed out first, so the rest of the line is the command or
+ * the name. A name can't start with 'M' and a number. The settings in the
+ * active tool's profile are also set by the same commands given directly.
+ * With no parameters all profiles are reported.
+ *
+ * Examples:
+ *   M726 T1 Alginate       ; Name the profile of tool 1
+ *   M726 T1 M203 E5        ; Set the E max feedrate of tool 1
+ */
+void GcodeSuite::M726() {
+  int8_t e = active_extruder, from = -1;
+  char *p = parser.string_arg;
+  if (!p || !*p) return M726_report(false);
+
+  for (uint8_t i = 2; i--;) {
+    // T<tool> and C<tool> are always parsed out
+    if (!((p[0] == 'T' || p[0] == 'C') && NUMERIC(p[1]))) break;
+    const int8_t t = atoi(p + 1);
+    if (!WITHIN(t, 0, EXTRUDERS - 1)) {
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Invalid T or C tool"));
+      return;
+    }
+    if (p[0] == 'T') e = t; else from = t;
+    for (++p; NUMERIC(*p); ++p) { /* nada */ }
+    while (*p == ' ') ++p;
+  }
+
+  // Trim trailing spaces from the name
+  for (char *end = p + strlen(p); end > p && end[-1] == ' ';) *--end = '\0';
+
+  if (from >= 0 && from != e) tool_profiles.copy(from, e);
+
+  if (p[0] == 'M' && NUMERIC(p[1])) {
+    switch (atoi(p + 1)) {
+      case 92: case 201: case 203: case 204: case 205:
+      #if _TP_ADVANCE_K
+        case 900:
+      #endif
+        break;
+      default:
+        SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Not a tool profile command"));
+        return;
+    }
+    tool_profiles.edit_begin(e);
+    process_subcommands_now(p);
+    tool_profiles.edit_end(e);
+  }
+  else if (*p)
+    tool_profiles.set_name(e, p);
+}
+
+#if AXIS_COLLISION('B')
+  #define M726_MIN_SEG_TIME_STR " D"
+#else
+  #define M726_MIN_SEG_TIME_STR " B"
+#endif
+
+// Print the axis letters of a per-axis setting with their values
+template<typename T>
+static void report_axes(const T (&v)[DISTINCT_AXES]) {
+  LOOP_LOGICAL_AXES(i)
+    SERIAL_ECHO(C(' '), C(AXIS_CHAR(i)), TERN_(HAS_EXTRUDERS, i == E_AXIS ? VOLUMETRIC_UNIT(v[i]) :) LINEAR_UNIT(v[i]));
+}
+
+void GcodeSuite::M726_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading(forReplay, F("Tool Motion Profiles"));
+  EXTRUDER_LOOP() {
+    // The live settings are newer than the stored profile of the active tool
+    const tool_profile_t &p = tool_profiles.profile[e];
+    const bool live = e == active_extruder;
+    const planner_settings_t &s = live ? planner.settings : p.planner;
+
+    if (p.name[0]) {
+      report_echo_start(forReplay);
+      SERIAL_ECHOLN(F("  M726 T"), e, C(' '), p.name);
+    }
+    report_echo_start(forReplay);
+    SERIAL_ECHOPGM("  M726 T", e, " M92");
+    report_axes(s.axis_steps_per_mm);
+    SERIAL_EOL();
+    report_echo_start(forReplay);
+    SERIAL_ECHOPGM("  M726 T", e, " M201");
+    report_axes(s.max_acceleration_mm_per_s2);
+    SERIAL_EOL();
+    report_echo_start(forReplay);
+    SERIAL_ECHOPGM("  M726 T", e, " M203");
+    report_axes(s.max_feedrate_mm_s);
+    SERIAL_EOL();
+    report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM(
+      "  M726 T", e, " M204 P", LINEAR_UNIT(s.acceleration),
+      " R", LINEAR_UNIT(s.retract_acceleration),
+      " T", LINEAR_UNIT(s.travel_acceleration)
+    );
+    report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM(
+      "  M726 T", e, " M205" M726_MIN_SEG_TIME_STR, s.min_segment_time_us,
+      " S", LINEAR_UNIT(s.min_feedrate_mm_s),
+      " T", LINEAR_UNIT(s.min_travel_feedrate_mm_s)
+    );
+    #if _TP_ADVANCE_K
+      report_echo_start(forReplay);
+      SERIAL_ECHOLNPGM("  M726 T", e, " M900 K", p_float_t(live ? planner.get_advance_k() : p.advance_K, 3));
+    #endif
+  }
+}
+
+#endif // TOOL_MOTION_PROFILES
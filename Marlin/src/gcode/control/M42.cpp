@@ -30,6 +30,10 @@
   #include "../../module/temperature.h"
 #endif
 
+#if ANY(HAS_FAN, OUTPUT_EVENT_BLOCKS)
+  #include "../../module/planner.h"
+#endif
+
 #ifdef MAPLE_STM32F1
   // these are enums on the F1...
   #define INPUT_PULLDOWN INPUT_PULLDOWN
@@ -55,6 +59,10 @@ void protected_pin_err() {
  *
  *  T<mode> Pin mode: 0=INPUT  1=OUTPUT  2=INPUT_PULLUP  3=INPUT_PULLDOWN
  *                    4=INPUT_ANALOG  5=OUTPUT_OPEN_DRAIN
+ *
+ * With OUTPUT_EVENT_BLOCKS:
+ *  Q       Queue the change with motion instead of applying it now
+ *  D<mm>   With Q, apply the change this far into the following XYZ travel
  */
 void GcodeSuite::M42() {
   const int pin_index = PARSED_PIN_INDEX('P', GET_PIN_MAP_INDEX(LED_PIN));
@@ -88,7 +96,7 @@ void GcodeSuite::M42() {
 
   #if HAS_FAN
     switch (pin) {
-      #define _CASE(N) case FAN##N##_PIN: thermalManager.fan_speed[N] = pin_status; return;
+      #define _CASE(N) case FAN##N##_PIN: thermalManager.fan_speed[N] = pin_status; planner.mark_block_state_changed(); return;
       REPEAT(FAN_COUNT, _CASE)
     }
   #endif
@@ -103,13 +111,25 @@ void GcodeSuite::M42() {
   #ifndef OUTPUT_OPEN_DRAIN
     pinMode(pin, OUTPUT);
   #endif
-  extDigitalWrite(pin, pin_status);
 
   #ifdef ARDUINO_ARCH_STM32
     // A simple I/O will be set to 0 by hal.set_pwm_duty()
-    if (pin_status <= 1 && !PWM_PIN(pin)) return;
+    const bool use_pwm = pin_status > 1 || PWM_PIN(pin);
+  #else
+    constexpr bool use_pwm = true;
   #endif
-  hal.set_pwm_duty(pin, pin_status);
+
+  #if ENABLED(OUTPUT_EVENT_BLOCKS)
+    if (parser.seen_test('Q')) {
+      // The Stepper ISR sets the duty, so the timer must exist beforehand
+      TERN_(ARDUINO_ARCH_STM32, if (use_pwm) hal.init_pwm_timer(pin));
+      planner.buffer_output_event({ pin, pin_status, use_pwm }, parser.linearval('D'));
+      return;
+    }
+  #endif
+
+  extDigitalWrite(pin, pin_status);
+  if (use_pwm) hal.set_pwm_duty(pin, pin_status);
 }
 
 #endif // DIRECT_PIN_CONTROL
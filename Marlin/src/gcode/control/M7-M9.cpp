@@ -32,8 +32,12 @@
    * M7: Mist Coolant On
    */
   void GcodeSuite::M7() {
-    planner.synchronize();                            // Wait for move to arrive
-    WRITE(COOLANT_MIST_PIN, !(COOLANT_MIST_INVERT));  // Turn on Mist coolant
+    #if ENABLED(OUTPUT_EVENT_BLOCKS)
+      planner.buffer_output_event({ COOLANT_MIST_PIN, !(COOLANT_MIST_INVERT), false }); // Turn on Mist coolant with motion
+    #else
+      planner.synchronize();                            // Wait for move to arrive
+      WRITE(COOLANT_MIST_PIN, !(COOLANT_MIST_INVERT));  // Turn on Mist coolant
+    #endif
   }
 #endif
 
@@ -47,8 +51,13 @@
    * M8: Flood Coolant / Air Assist ON
    */
   void GcodeSuite::M8() {
-    planner.synchronize();                            // Wait for move to arrive
-    #if ENABLED(COOLANT_FLOOD)
+    #if ALL(OUTPUT_EVENT_BLOCKS, COOLANT_FLOOD)
+      planner.buffer_output_event({ COOLANT_FLOOD_PIN, !(COOLANT_FLOOD_INVERT), false }); // Turn on Flood coolant with motion
+    #endif
+    #if ENABLED(AIR_ASSIST) || DISABLED(OUTPUT_EVENT_BLOCKS)
+      planner.synchronize();                          // Wait for move to arrive
+    #endif
+    #if ENABLED(COOLANT_FLOOD) && DISABLED(OUTPUT_EVENT_BLOCKS)
       WRITE(COOLANT_FLOOD_PIN, !(COOLANT_FLOOD_INVERT)); // Turn on Flood coolant
     #endif
     #if ENABLED(AIR_ASSIST)
@@ -62,12 +71,24 @@
  * M9: Coolant / Air Assist OFF
  */
 void GcodeSuite::M9() {
-  planner.synchronize();                              // Wait for move to arrive
-  #if ENABLED(COOLANT_MIST)
-    WRITE(COOLANT_MIST_PIN, COOLANT_MIST_INVERT);     // Turn off Mist coolant
+  #if ENABLED(OUTPUT_EVENT_BLOCKS)
+    #if ENABLED(COOLANT_MIST)
+      planner.buffer_output_event({ COOLANT_MIST_PIN, COOLANT_MIST_INVERT, false });   // Turn off Mist coolant with motion
+    #endif
+    #if ENABLED(COOLANT_FLOOD)
+      planner.buffer_output_event({ COOLANT_FLOOD_PIN, COOLANT_FLOOD_INVERT, false }); // Turn off Flood coolant with motion
+    #endif
+  #endif
+  #if ENABLED(AIR_ASSIST) || DISABLED(OUTPUT_EVENT_BLOCKS)
+    planner.synchronize();                            // Wait for move to arrive
   #endif
-  #if ENABLED(COOLANT_FLOOD)
-    WRITE(COOLANT_FLOOD_PIN, COOLANT_FLOOD_INVERT);   // Turn off Flood coolant
+  #if DISABLED(OUTPUT_EVENT_BLOCKS)
+    #if ENABLED(COOLANT_MIST)
+      WRITE(COOLANT_MIST_PIN, COOLANT_MIST_INVERT);   // Turn off Mist coolant
+    #endif
+    #if ENABLED(COOLANT_FLOOD)
+      WRITE(COOLANT_FLOOD_PIN, COOLANT_FLOOD_INVERT); // Turn off Flood coolant
+    #endif
   #endif
   #if ENABLED(AIR_ASSIST)
     cutter.air_assist_disable();                      // Turn off Air Assist
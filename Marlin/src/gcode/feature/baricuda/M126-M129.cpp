@@ -26,18 +26,19 @@
 
 #include "../../gcode.h"
 #include "../../../feature/baricuda.h"
+#include "../../../module/planner.h"
 
 #if HAS_HEATER_1
 
   /**
    * M126: Heater 1 valve open
    */
-  void GcodeSuite::M126() { baricuda_valve_pressure = parser.byteval('S', 255); }
+  void GcodeSuite::M126() { baricuda_valve_pressure = parser.byteval('S', 255); planner.mark_block_state_changed(); }
 
   /**
    * M127: Heater 1 valve close
    */
-  void GcodeSuite::M127() { baricuda_valve_pressure = 0; }
+  void GcodeSuite::M127() { baricuda_valve_pressure = 0; planner.mark_block_state_changed(); }
 
 #endif // HAS_HEATER_1
 
@@ -46,12 +47,12 @@
   /**
    * M128: Heater 2 valve open
    */
-  void GcodeSuite::M128() { baricuda_e_to_p_pressure = parser.byteval('S', 255); }
+  void GcodeSuite::M128() { baricuda_e_to_p_pressure = parser.byteval('S', 255); planner.mark_block_state_changed(); }
 
   /**
    * M129: Heater 2 valve close
    */
-  void GcodeSuite::M129() { baricuda_e_to_p_pressure = 0; }
+  void GcodeSuite::M129() { baricuda_e_to_p_pressure = 0; planner.mark_block_state_changed(); }
 
 #endif // HAS_HEATER_2
 
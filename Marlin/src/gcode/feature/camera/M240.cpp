@@ -27,6 +27,10 @@
 #include "../../gcode.h"
 #include "../../../module/motion.h" // for active_extruder and current_position
 
+#if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+  #include "../../../feature/camera_capture.h"
+#endif
+
 #if PIN_EXISTS(CHDK)
   millis_t chdk_timeout; // = 0
 #endif
@@ -116,6 +120,11 @@
  *    Y - Move to Y before triggering the shutter
  *    Z - Raise Z by a distance before triggering the shutter
  *
+ * CAMERA_CAPTURE_SCHEDULER parameters:
+ *    Q - Queue the trigger with the moves, after Q mm of travel if given.
+ *        The stamp is reported to the host as "Capture:<n> X Y Z T" when
+ *        the trigger fires. Without Q the camera is triggered right away.
+ *
  * PHOTO_SWITCH_POSITION parameters:
  *    D - Duration (ms) to hold down switch (Requires PHOTO_SWITCH_MS)
  *    P - Delay (ms) after triggering the shutter (Requires PHOTO_SWITCH_MS)
@@ -124,6 +133,10 @@
  */
 void GcodeSuite::M240() {
 
+  #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+    if (parser.seen('Q')) return cameraCapture.queue(parser.linearval('Q'));
+  #endif
+
   #ifdef PHOTO_POSITION
 
     if (homing_needed_error()) return;
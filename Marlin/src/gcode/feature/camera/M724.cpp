@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+
+#include "../../gcode.h"
+#include "../../../feature/camera_capture.h"
+
+/**
+ * M724: Schedule camera captures along the print
+ *
+ *   S<mm>    : Capture every S mm of printed path. 0 to disable.
+ *   L<bool>  : Capture when printing resumes at a higher Z, imaging the layer below.
+ *   R        : Clear the schedule and restart the capture numbering
+ *
+ * Scheduled captures ride on the planned moves, so they take effect with
+ * the moves that follow this command. With no parameters the schedule is
+ * reported.
+ */
+void GcodeSuite::M724() {
+  if (!parser.seen("SLR")) {
+    SERIAL_ECHOLNPGM("M724 S", p_float_t(cameraCapture.interval_mm, 2), " L", cameraCapture.every_layer);
+    return;
+  }
+
+  if (parser.seen('R')) cameraCapture.reset();
+
+  if (parser.seenval('S')) {
+    const float mm = parser.value_linear_units();
+    if (mm < 0)
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("S value must be positive"));
+    else
+      cameraCapture.interval_mm = mm;
+  }
+
+  if (parser.seen('L')) cameraCapture.every_layer = parser.value_bool();
+}
+
+#endif // CAMERA_CAPTURE_SCHEDULER
@@ -27,6 +27,10 @@
 #include "../../gcode.h"
 #include "../../../feature/cancel_object.h"
 
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+  #include "../../../module/motion.h"
+#endif
+
 /**
  * M486: A simple interface to cancel objects
  *
@@ -36,6 +40,11 @@
  *   U<index> : Un-cancel object with the given index
  *   C        : Cancel the current object (the last index given by S<index>)
  *   S-1      : Start a non-object like a brim or purge tower that should always print
+ *
+ * With CANCEL_OBJECTS_SEEK the SD reader adds these after passing over a canceled object:
+ *   X Y Z    : Where its moves ended, or their sum in G91 mode. A travel move goes there.
+ *   E<pos>   : The E position its moves ended at (ignored with relative E)
+ *   F<rate>  : The feedrate its moves ended with
  */
 void GcodeSuite::M486() {
 
@@ -52,6 +61,24 @@ void GcodeSuite::M486() {
   if (parser.seenval('P')) cancelable.cancel_object(parser.value_int());
 
   if (parser.seenval('U')) cancelable.uncancel_object(parser.value_int());
+
+  #if ENABLED(CANCEL_OBJECTS_SEEK)
+    if (parser.seenval('E') && !axis_is_relative(E_AXIS)) {
+      current_position.e = parser.value_axis_units(E_AXIS);
+      sync_plan_position_e();
+    }
+    if (parser.seenval('F')) feedrate_mm_s = MMM_TO_MMS(parser.value_linear_units());
+
+    // Keep the position the skipped moves left behind, such as a new layer height
+    if (parser.seen("XYZ")) {
+      destination = current_position;
+      LOOP_NUM_AXES(i) if (i <= Z_AXIS && parser.seenval(AXIS_CHAR(i))) {
+        const float v = parser.value_axis_units(AxisEnum(i));
+        destination[i] = axis_is_relative(AxisEnum(i)) ? current_position[i] + v : LOGICAL_TO_NATIVE(v, i);
+      }
+      prepare_line_to_destination();
+    }
+  #endif
 }
 
 #endif // CANCEL_OBJECTS
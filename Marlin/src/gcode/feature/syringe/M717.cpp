@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_AUTO_ZERO)
+
+#include "../../gcode.h"
+#include "../../../feature/syringe_zero.h"
+
+/**
+ * M717: Syringe plunger auto-zero
+ *
+ *   P<mask>   : Bit mask of the syringes to zero (Default: all)
+ *   T<tool>   : Zero a single syringe instead of a mask
+ *   F<feed>   : Approach feedrate in mm/min
+ *   L<mm>     : Preload back-off after contact
+ *   D<mm>     : Maximum plunger travel before giving up
+ *   S<thrs>   : StallGuard threshold for the E drivers (TMC2209: 0...255)
+ *
+ * With no P or T the current settings are reported.
+ */
+void GcodeSuite::M717() {
+  if (parser.seenval('F')) syringe_zero.feedrate_mm_s = MMM_TO_MMS(parser.value_feedrate());
+  if (parser.seenval('L')) syringe_zero.preload_mm = parser.value_linear_units();
+  if (parser.seenval('D')) syringe_zero.max_travel_mm = parser.value_linear_units();
+  if (parser.seenval('S')) syringe_zero.stall_threshold = constrain(parser.value_int(), 0, 255);
+
+  uint8_t mask;
+  if (parser.seenval('T'))
+    mask = _BV(parser.value_byte());
+  else if (parser.seen('P'))
+    mask = parser.has_value() ? parser.value_byte() : _BV(E_STEPPERS) - 1;
+  else {
+    SERIAL_ECHOLNPGM(
+      "Syringe zero F", LINEAR_UNIT(MMS_TO_MMM(syringe_zero.feedrate_mm_s)),
+      " L", LINEAR_UNIT(syringe_zero.preload_mm),
+      " D", LINEAR_UNIT(syringe_zero.max_travel_mm),
+      " S", syringe_zero.stall_threshold
+    );
+    return;
+  }
+
+  const uint8_t contact = syringe_zero.zero(mask);
+
+  for (uint8_t e = 0; e < E_STEPPERS; ++e) if (TEST(mask, e)) {
+    SERIAL_ECHOPGM("Syringe ", e);
+    if (TEST(contact, e)) SERIAL_ECHOLNPGM(" zeroed"); else SERIAL_ECHOLNPGM(" no contact");
+  }
+}
+
+#endif // SYRINGE_AUTO_ZERO
@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_FLOW_MODEL)
+
+#include "../../gcode.h"
+#include "../../../feature/syringe_flow.h"
+#include "../../../module/planner.h"
+
+/**
+ * M718: Set the syringe flow model of a tool
+ *
+ *   T<tool>   : Tool to configure (Default: active tool)
+ *   D<mm>     : Inner diameter of the syringe barrel, used for volumetric extrusion.
+ *               D0 uses the M200 filament diameter instead.
+ *   B<gauge>  : Needle gauge (14-34). The advance time is K scaled to this needle.
+ *               B0 uses K as the advance time.
+ *   K<sec>    : Pressure time constant with a SYRINGE_TAU_GAUGE needle
+ *
+ * With no parameters the settings of all tools are reported.
+ */
+void GcodeSuite::M718() {
+  if (!parser.seen("DBK")) return M718_report(false);
+
+  const int8_t e = get_target_extruder_from_command();
+  if (e < 0) return;
+
+  syringe_flow_settings_t &s = syringe_flow.settings[e];
+
+  if (parser.seenval('D')) s.syringe_id = parser.value_linear_units();
+  if (parser.seenval('B')) {
+    const uint8_t gauge = parser.value_byte();
+    if (!gauge || syringe_flow.needle_id(gauge))
+      s.needle_gauge = gauge;
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Unknown needle gauge"));
+  }
+  if (parser.seenval('K')) {
+    const float tau = parser.value_float();
+    if (WITHIN(tau, 0, 10))
+      s.tau = tau;
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("K value out of range (0-10)"));
+  }
+
+  planner.synchronize();
+  syringe_flow.apply(e);
+}
+
+void GcodeSuite::M718_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading(forReplay, F("Syringe Flow Model"));
+  EXTRUDER_LOOP() {
+    const syringe_flow_settings_t &s = syringe_flow.settings[e];
+    report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM(
+      "  M718 T", e,
+      " D", LINEAR_UNIT(s.syringe_id),
+      " B", s.needle_gauge,
+      " K", p_float_t(s.tau, 3)
+    );
+  }
+}
+
+#endif // SYRINGE_FLOW_MODEL
@@ -49,6 +49,8 @@ void GcodeSuite::M122() {
 
   if (parser.boolval('I')) restore_stepper_drivers();
 
+  SERIAL_REPORT_SCOPE();
+
   #if ENABLED(TMC_DEBUG)
     #if ENABLED(MONITOR_DRIVER_STATUS)
       const bool sflag = parser.seen_test('S'), sval = sflag && parser.value_bool();
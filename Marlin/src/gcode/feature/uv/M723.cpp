@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(UV_EXPOSURE_HEAD)
+
+#include "../../gcode.h"
+#include "../../../feature/uv_exposure.h"
+
+/**
+ * M723: Set the UV exposure head
+ *
+ *   S<bool>     : Expose extruding moves
+ *   P<channel>  : Channel to set the dose of (Default: all)
+ *   D<dose>     : PWM counts per mm/s of head speed. Power saturates at 255.
+ *
+ * New settings apply to moves planned after this command, so exposure
+ * switches on and off in step with the G-code without a synchronize.
+ * With no parameters the current settings are reported.
+ */
+void GcodeSuite::M723() {
+  if (!parser.seen("SPD")) return M723_report(false);
+
+  if (parser.seen('S')) uvExposure.enabled = parser.value_bool();
+
+  if (parser.seenval('D')) {
+    const float d = parser.value_float();
+    if (d < 0) {
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("D value must be positive"));
+      return;
+    }
+    if (parser.seenval('P')) {
+      const uint8_t c = parser.value_byte();
+      if (c >= UV_EXPOSURE_CHANNELS) {
+        SERIAL_ECHOLNPGM(GCODE_ERR_MSG("P channel out of range (0-", UV_EXPOSURE_CHANNELS - 1, ")"));
+        return;
+      }
+      uvExposure.dose[c] = d;
+    }
+    else
+      for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c) uvExposure.dose[c] = d;
+  }
+}
+
+void GcodeSuite::M723_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading(forReplay, F("UV Exposure Head"));
+  report_echo_start(forReplay);
+  SERIAL_ECHOLNPGM("  M723 S", uvExposure.enabled);
+  for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c) {
+    report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM("  M723 P", c, " D", p_float_t(uvExposure.dose[c], 2));
+  }
+}
+
+#endif // UV_EXPOSURE_HEAD
@@ -69,6 +69,10 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../module/coalescer.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -343,6 +347,11 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
     }
   #endif
 
+  #if ENABLED(SEGMENT_COALESCING)
+    // Only G0/G1 may fold into a held move. Anything else runs after it.
+    if (!(parser.command_letter == 'G' && parser.codenum <= 1)) coalescer.flush();
+  #endif
+
   // Handle a known command or reply "unknown command"
 
   switch (parser.command_letter) {
@@ -1011,6 +1020,46 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 710: M710(); break;                                  // M710: Set Controller Fan settings
       #endif
 
+      #if ENABLED(SYRINGE_AUTO_ZERO)
+        case 717: M717(); break;                                  // M717: Syringe plunger auto-zero
+      #endif
+
+      #if ENABLED(SYRINGE_FLOW_MODEL)
+        case 718: M718(); break;                                  // M718: Syringe flow model
+      #endif
+
+      #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+        case 719: M719(); break;                                  // M719: Curve segmentation
+      #endif
+
+      #if ENABLED(RUNTIME_BLOCK_BUFFER)
+        case 720: M720(); break;                                  // M720: Planner block ring size
+      #endif
+
+      #if ENABLED(PLANNER_LOOKAHEAD_STATS)
+        case 721: M721(); break;                                  // M721: Planner lookahead stats
+      #endif
+
+      #if ENABLED(DIRECT_STEPPING_SD)
+        case 722: M722(); break;                                  // M722: Stream step pages from media
+      #endif
+
+      #if ENABLED(UV_EXPOSURE_HEAD)
+        case 723: M723(); break;                                  // M723: UV exposure head
+      #endif
+
+      #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+        case 724: M724(); break;                                  // M724: Camera capture schedule
+      #endif
+
+      #if ENABLED(PREFLIGHT_SCAN)
+        case 725: M725(); break;                                  // M725: Pre-flight scan of a media file
+      #endif
+
+      #if ENABLED(TOOL_MOTION_PROFILES)
+        case 726: M726(); break;                                  // M726: Per-tool motion profiles
+      #endif
+
       #if ENABLED(GCODE_MACROS)
         case 810: case 811: case 812: case 813: case 814:
         case 815: case 816: case 817: case 818: case 819:
@@ -205,7 +205,7 @@
  *        Use "M220 B" to back up the Feedrate Percentage and "M220 R" to restore it. (Requires an MMU_MODEL version 2 or 2S)
  * M221 - Set Flow Percentage: "M221 S<percent>" (Requires an extruder)
  * M226 - Wait until a pin is in a given state: "M226 P<pin> S<state>" (Requires DIRECT_PIN_CONTROL)
- * M240 - Trigger a camera to take a photograph. (Requires PHOTO_GCODE)
+ * M240 - Trigger a camera to take a photograph, or queue it with M240 Q. (Requires PHOTO_GCODE)
  * M250 - Set LCD contrast: "M250 C<contrast>" (0-63). (Requires LCD support)
  * M255 - Set LCD sleep time: "M255 S<minutes>" (0-99). (Requires an LCD with brightness or sleep/wake)
  * M256 - Set LCD brightness: "M256 B<brightness>" (0-255). (Requires an LCD with brightness control)
@@ -279,6 +279,16 @@
  * M672 - Set/Reset Duet Smart Effector's sensitivity. (Requires DUET_SMART_EFFECTOR and SMART_EFFECTOR_MOD_PIN)
  * M701 - Load filament (Requires FILAMENT_LOAD_UNLOAD_GCODES)
  * M702 - Unload filament (Requires FILAMENT_LOAD_UNLOAD_GCODES)
+ * M717 - Syringe plunger auto-zero: "M717 [P<mask>|T<tool>] [F<feedrate>] [L<preload>] [D<travel>] [S<threshold>]". (Requires SYRINGE_AUTO_ZERO)
+ * M718 - Set or report the syringe flow model: "M718 [T<tool>] [D<syringe_id>] [B<gauge>] [K<tau>]". (Requires SYRINGE_FLOW_MODEL)
+ * M719 - Set or report the G2/G3/G5 segmentation: "M719 [S<tolerance>] [B<tolerance>] [R<stretch>]". (Requires ADAPTIVE_CURVE_SEGMENTS)
+ * M720 - Set or report the planner block ring size: "M720 [S<blocks>]". (Requires RUNTIME_BLOCK_BUFFER)
+ * M721 - Report planner lookahead work per block: "M721 [R]". (Requires PLANNER_LOOKAHEAD_STATS)
+ * M722 - Stream queue-step pages from a media file: "M722 <filename>". (Requires DIRECT_STEPPING_SD)
+ * M723 - Set or report the UV exposure head: "M723 [S<bool>] [P<channel>] [D<dose>]". (Requires UV_EXPOSURE_HEAD)
+ * M724 - Schedule camera captures along the print: "M724 [S<mm>] [L<bool>] [R]". (Requires CAMERA_CAPTURE_SCHEDULER)
+ * M725 - Report or run the pre-flight scan of a media file: "M725 [filename]". (Requires PREFLIGHT_SCAN)
+ * M726 - Name, copy, set, or report per-tool motion profiles: "M726 [T<tool>] [C<from>] [M<code> ...|name]". (Requires TOOL_MOTION_PROFILES)
  *
  *** PRUSA_MMU3 ***
  * M704 - Preload to MMU
@@ -1202,6 +1212,51 @@ private:
     static void MMU3_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(SYRINGE_AUTO_ZERO)
+    static void M717();
+  #endif
+
+  #if ENABLED(SYRINGE_FLOW_MODEL)
+    static void M718();
+    static void M718_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+    static void M719();
+    static void M719_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(RUNTIME_BLOCK_BUFFER)
+    static void M720();
+    static void M720_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(PLANNER_LOOKAHEAD_STATS)
+    static void M721();
+  #endif
+
+  #if ENABLED(DIRECT_STEPPING_SD)
+    static void M722();
+  #endif
+
+  #if ENABLED(UV_EXPOSURE_HEAD)
+    static void M723();
+    static void M723_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+    static void M724();
+  #endif
+
+  #if ENABLED(PREFLIGHT_SCAN)
+    static void M725();
+  #endif
+
+  #if ENABLED(TOOL_MOTION_PROFILES)
+    static void M726();
+    static void M726_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(GCODE_REPEAT_MARKERS)
     static void M808();
   #endif
@@ -123,25 +123,33 @@
  *   R - Report the realtime position instead of projected.
  */
 void GcodeSuite::M114() {
-
   #if ENABLED(M114_DETAIL)
     if (parser.seen_test('D')) {
       IF_DISABLED(M114_LEGACY, planner.synchronize());
+      SERIAL_REPORT_SCOPE(); // Only after idle() is done, so other output isn't held
       report_current_position();
       report_current_position_detail();
       return;
     }
     #if HAS_EXTRUDERS
       if (parser.seen_test('E')) {
+        SERIAL_REPORT_SCOPE();
         SERIAL_ECHOLNPGM("Count E:", stepper.position(E_AXIS));
         return;
       }
     #endif
   #endif
 
-  TERN_(M114_REALTIME, if (parser.seen_test('R')) return report_real_position());
+  #if ENABLED(M114_REALTIME)
+    if (parser.seen_test('R')) {
+      SERIAL_REPORT_SCOPE();
+      return report_real_position();
+    }
+  #endif
 
   TERN_(M114_LEGACY, planner.synchronize());
+
+  SERIAL_REPORT_SCOPE();
   report_current_position_projected();
 
   TERN_(FULL_REPORT_TO_HOST_FEATURE, report_current_grblstate_moving());
@@ -29,6 +29,13 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  #include "../../module/ft_motion.h"
+#endif
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+  #include "../../module/curve_segmenter.h"
+#endif
+
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
   #define N_ARC_CORRECTION 1
@@ -214,23 +221,90 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Get the ideal segment length for the move based on settings
-  const float ideal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
-      constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
-    #else
-      MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
-    #endif
-  );
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    /**
+     * MarlinBio: FT Motion interpolates curved blocks along the true arc, so the arc
+     * is only split into pieces of up to ARC_NATIVE_MAX_SWEEP. Bed leveling and the
+     * standard stepper still need the short linear segments below.
+     */
+    if (ftMotion.cfg.active && !planner.leveling_active && TERN1(CNC_WORKSPACE_PLANES, gcode.workspace_plane == GcodeSuite::PLANE_XY)) {
+      const uint16_t pieces = _MAX(1, CEIL(abs_angular_travel / RADIANS(ARC_NATIVE_MAX_SWEEP)));
+      const float piece_sweep = angular_travel / pieces,
+                  limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]),
+                  limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]),
+                  limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * radius, sq(scaled_fr_mm_s));
+
+      PlannerHints hints;
+      hints.arc_sweep = piece_sweep;
+      hints.millimeters = TERN(HAS_Z_AXIS, HYPOT(flat_mm, travel_L), flat_mm) / pieces;
+
+      xyze_pos_t raw;
+      for (uint16_t i = 1; i <= pieces; ++i) {
+        // Radius vector at the start of this piece, from the initial radius vector (= -offset)
+        const float T0 = (i - 1) * piece_sweep, cos_T0 = cos(T0), sin_T0 = sin(T0);
+        hints.arc_rvec.set(-offset[0] * cos_T0 + offset[1] * sin_T0, -offset[0] * sin_T0 - offset[1] * cos_T0);
+
+        if (i < pieces) {
+          const float Ti = i * piece_sweep, cos_Ti = cos(Ti), sin_Ti = sin(Ti), f = float(i) / pieces;
+          raw[axis_p] = center_P - offset[0] * cos_Ti + offset[1] * sin_Ti;
+          raw[axis_q] = center_Q - offset[0] * sin_Ti - offset[1] * cos_Ti;
+          ARC_LIJKUVWE_CODE(
+            raw[axis_l] = start_L + travel_L * f,
+            raw.i       = start_I + travel_I * f,
+            raw.j       = start_J + travel_J * f,
+            raw.k       = start_K + travel_K * f,
+            raw.u       = start_U + travel_U * f,
+            raw.v       = start_V + travel_V * f,
+            raw.w       = start_W + travel_W * f,
+            raw.e       = start_E + travel_E * f
+          );
+          hints.safe_exit_speed_sqr = _MIN(limiting_speed_sqr, 2 * limiting_accel * flat_mm * (1.0f - f));
+        }
+        else {
+          raw = cart;
+          hints.safe_exit_speed_sqr = 0.0f;
+        }
+
+        apply_motion_limits(raw);
+
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
 
-  // Number of whole segments based on the ideal segment length
-  const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
-              nominal_segment_mm = flat_mm / nominal_segments;
+        hints.curve_radius = radius;
+      }
 
-  // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
-  const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
-                            nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
-                            nominal_segments;
+      current_position = cart;
+      return;
+    }
+  #endif
+
+  #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+
+    // MarlinBio: The chord tolerance and the planner headroom set the segment length,
+    // but never fewer segments than MIN_CIRCLE_SEGMENTS calls for
+    const uint16_t segments = _MAX(min_segments, CEIL(flat_mm / curve_segmenter.segment_mm(radius)));
+
+  #else
+
+    // Get the ideal segment length for the move based on settings
+    const float ideal_segment_mm = (
+      #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+        constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+      #else
+        MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
+      #endif
+    );
+
+    // Number of whole segments based on the ideal segment length
+    const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
+                nominal_segment_mm = flat_mm / nominal_segments;
+
+    // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
+    const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
+                              nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
+                              nominal_segments;
+
+  #endif
   const float segment_mm = flat_mm / segments;
 
   // Add hints to help optimize the move
@@ -31,6 +31,9 @@
 
 /**
  * G6: Direct Stepper Move
+ *
+ * With SP_QS_256 pages the step count comes from the page header (S overrides it)
+ * and the page is checked before it is queued.
  */
 void GcodeSuite::G6() {
   // TODO: feedrate support?
@@ -58,7 +61,21 @@ void GcodeSuite::G6() {
   uint16_t num_steps = DirectStepping::Config::TOTAL_STEPS;
   if (parser.seen('S')) num_steps = parser.value_ushort();
 
-  planner.buffer_page(page_idx, 0, num_steps);
+  #if HAS_QS_STEP_PAGES
+    // Queue-step pages carry their own length
+    const uint8_t * const page = page_manager.get_page(page_idx);
+    const uint16_t page_ticks = page ? DirectStepping::qs_page_ticks(page, DirectStepping::Config::PAGE_SIZE) : 0;
+    if (!page_ticks) {
+      if (page) page_manager.free_page(page_idx);
+      SERIAL_ERROR_MSG("Bad page: ", page_idx);
+      return;
+    }
+    if (!num_steps) num_steps = page_ticks;
+    // The stepper position follows the active extruder
+    planner.buffer_page(page_idx, active_extruder, num_steps);
+  #else
+    planner.buffer_page(page_idx, 0, num_steps);
+  #endif
   reset_stepper_timeout();
 }
 
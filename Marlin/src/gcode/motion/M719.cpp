@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+
+#include "../gcode.h"
+#include "../../module/curve_segmenter.h"
+
+/**
+ * M719: Set the segmentation of G2/G3 arcs and G5 Bézier curves
+ *
+ *   S<mm>     : Max deviation of a G2/G3 segment from the arc
+ *   B<mm>     : Max deviation of a G5 segment from the curve
+ *   R<factor> : Max segment length factor when the planner is nearly full (1 = no stretch)
+ *
+ * With no parameters the current settings are reported.
+ */
+void GcodeSuite::M719() {
+  if (!parser.seen("SBR")) return M719_report(false);
+
+  curve_segmenter_settings_t &s = curve_segmenter.settings;
+
+  if (parser.seenval('S')) {
+    const float tol = parser.value_linear_units();
+    if (WITHIN(tol, 0.001f, 1.0f))
+      s.tolerance = tol;
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("S value out of range (0.001-1)"));
+  }
+  if (parser.seenval('B')) {
+    const float tol = parser.value_linear_units();
+    if (WITHIN(tol, 0.001f, 1.0f))
+      s.bezier_tolerance = tol;
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("B value out of range (0.001-1)"));
+  }
+  if (parser.seenval('R')) {
+    const float stretch = parser.value_float();
+    if (WITHIN(stretch, 1.0f, 10.0f))
+      s.stretch = stretch;
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("R value out of range (1-10)"));
+  }
+}
+
+void GcodeSuite::M719_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  const curve_segmenter_settings_t &s = curve_segmenter.settings;
+  report_heading_etc(forReplay, F("Curve Segmentation"));
+  SERIAL_ECHOLNPGM(
+    "  M719 S", p_float_t(LINEAR_UNIT(s.tolerance), 3),
+    " B", p_float_t(LINEAR_UNIT(s.bezier_tolerance), 3),
+    " R", p_float_t(s.stretch, 2)
+  );
+}
+
+#endif // ADAPTIVE_CURVE_SEGMENTS
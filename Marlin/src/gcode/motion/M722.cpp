@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(DIRECT_STEPPING_SD)
+
+#include "../../feature/direct_stepping.h"
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+#include "../../sd/cardreader.h"
+#include "../../MarlinCore.h"
+
+/**
+ * M722: Stream queue-step pages from a media file
+ *
+ *   M722 <filename>
+ *
+ * The file starts with "QSP1" and a uint32 step rate (ticks per second),
+ * followed by frames of { uint16 size, page[size] }, all little-endian.
+ * Each frame fills a free page which is queued as soon as it is checked.
+ * The command returns once the last page is queued.
+ */
+void GcodeSuite::M722() {
+  if (!card.isMounted()) {
+    SERIAL_ECHO_MSG(STR_NO_MEDIA);
+    return;
+  }
+
+  MediaFile file, *dir;
+  const char * const fname = card.diveToFile(false, dir, parser.string_arg);
+  if (!fname || !file.open(dir, fname, O_READ)) {
+    SERIAL_ECHOLN(F(STR_SD_OPEN_FILE_FAIL), parser.string_arg, C('.'));
+    return;
+  }
+
+  uint8_t head[8];
+  if (file.read(head, sizeof(head)) != int16_t(sizeof(head)) || strncmp((char*)head, "QSP1", 4)) {
+    file.close();
+    SERIAL_ERROR_MSG("Not a step page file");
+    return;
+  }
+  planner.last_page_step_rate = head[4] | (head[5] << 8) | (uint32_t(head[6]) << 16) | (uint32_t(head[7]) << 24);
+
+  page_manager.set_local_source(true);
+
+  uint32_t pages = 0;
+  uint8_t size_le[2];
+  while (file.read(size_le, 2) == 2) {
+    if (!IsRunning() || card.flag.abort_sd_printing) break;
+
+    const uint16_t size = size_le[0] | (size_le[1] << 8);
+    if (!WITHIN(size, 4, DirectStepping::Config::PAGE_SIZE)) {
+      SERIAL_ERROR_MSG("Bad page size at page ", pages);
+      break;
+    }
+
+    // Wait for the stepper to release a page
+    page_idx_t page_idx;
+    while (!page_manager.claim_page(page_idx)) idle();
+
+    uint8_t * const page = page_manager.get_page(page_idx);
+    const uint16_t ticks = file.read(page, size) == int16_t(size) ? DirectStepping::qs_page_ticks(page, size) : 0;
+    if (!ticks) {
+      page_manager.free_page(page_idx);
+      SERIAL_ERROR_MSG("Bad page ", pages);
+      break;
+    }
+
+    page_manager.commit_page(page_idx);
+    planner.buffer_page(page_idx, active_extruder, ticks);
+    reset_stepper_timeout();
+    pages++;
+  }
+
+  file.close();
+
+  // Pages still queued free themselves as they complete
+  page_manager.set_local_source(false);
+
+  SERIAL_ECHOLNPGM("Streamed ", pages, " pages");
+}
+
+#endif // DIRECT_STEPPING_SD
@@ -277,6 +277,9 @@ void GCodeParser::parse(char *p) {
     TERN_(HAS_STATUS_MESSAGE, case 117:)
     TERN_(HAS_RS485_SERIAL, case 485:)
     TERN_(GCODE_MACROS, case 810 ... 819:)
+    TERN_(DIRECT_STEPPING_SD, case 722:)
+    TERN_(PREFLIGHT_SCAN, case 725:)
+    TERN_(TOOL_MOTION_PROFILES, case 726:)
     case 118:
       string_arg = unescape_string(p);
       return;
@@ -49,6 +49,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+  #include "../feature/cancel_object.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -574,6 +578,23 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
+
+      #if ENABLED(CANCEL_OBJECTS_SEEK)
+        // Pass over the moves of a canceled object instead of queueing them.
+        // Only at the start of a line, and not again until a line it stopped at is read.
+        if (cancelable.seeking && !cancelable.seek_held && sd_count == 0) {
+          const bool done = cancelable.seek_moves(card);
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+          // Hand on the position, E, and feedrate the skipped moves left behind
+          if (cancelable.seek_state(ring_buffer.commands[ring_buffer.index_w].buffer))
+            ring_buffer.commit_command(true);
+          if (card.eof()) { card.fileHasFinished(); continue; }
+          if (!done) break;
+          cancelable.seek_held = true;
+          if (ring_buffer.full()) break;
+        }
+      #endif
+
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -590,6 +611,9 @@ void GCodeQueue::get_serial_commands() {
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
           TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
 
+          // M486 S tells whether the following moves can be passed over
+          TERN_(CANCEL_OBJECTS_SEEK, cancelable.early_parse(command.buffer));
+
           #if DISABLED(PARK_HEAD_ON_PAUSE)
             // When M25 is non-blocking it can still suspend SD commands
             // Otherwise the M125 handler needs to know SD printing is active
@@ -604,6 +628,9 @@ void GCodeQueue::get_serial_commands() {
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
         }
 
+        // The line the seek stopped at has been read
+        TERN_(CANCEL_OBJECTS_SEEK, cancelable.seek_held = false);
+
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
       else
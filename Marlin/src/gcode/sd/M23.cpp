@@ -28,6 +28,10 @@
 #include "../../sd/cardreader.h"
 #include "../../lcd/marlinui.h"
 
+#if ENABLED(PREFLIGHT_SCAN)
+  #include "../../feature/preflight.h"
+#endif
+
 /**
  * M23: Open a file
  *
@@ -36,8 +40,16 @@
 void GcodeSuite::M23() {
   // Simplify3D includes the size, so zero out all spaces (#7227)
   for (char *fn = parser.string_arg; *fn; ++fn) if (*fn == ' ') *fn = '\0';
+
+  #if ENABLED(PREFLIGHT_SCAN)
+    const bool in_job = card.isPrinting();
+  #endif
+
   card.openFileRead(parser.string_arg);
 
+  // Report the cached pre-flight scan or start a new one, unless a running job opened the file
+  TERN_(PREFLIGHT_SCAN, if (!in_job && card.isFileOpen()) preflight.select(parser.string_arg));
+
   TERN_(SET_PROGRESS_PERCENT, ui.set_progress(0));
 }
 
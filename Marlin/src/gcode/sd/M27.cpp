@@ -27,6 +27,10 @@
 #include "../gcode.h"
 #include "../../sd/cardreader.h"
 
+#if ENABLED(PREFLIGHT_SCAN)
+  #include "../../feature/preflight.h"
+#endif
+
 /**
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
@@ -47,6 +51,7 @@ void GcodeSuite::M27() {
   #endif
 
   card.report_status();
+  TERN_(PREFLIGHT_SCAN, preflight.report_eta());
 }
 
 #endif // HAS_MEDIA
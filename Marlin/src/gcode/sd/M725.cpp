@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PREFLIGHT_SCAN)
+
+#include "../gcode.h"
+#include "../../feature/preflight.h"
+
+/**
+ * M725: Report or run the pre-flight scan of a media file
+ *
+ *   M725            : Report the last scan, or the progress of the current one
+ *   M725 <filename> : Scan the file again, ignoring its sidecar
+ *
+ * The report gives the estimated time, tool changes, the most E each tool
+ * pushes out at once with its volume in mm³ (µL), and the print bounds.
+ */
+void GcodeSuite::M725() {
+  if (!parser.string_arg || !*parser.string_arg) return preflight.report();
+
+  if (!card.isMounted()) {
+    SERIAL_ECHO_MSG(STR_NO_MEDIA);
+    return;
+  }
+
+  MediaFile *dir;
+  const char * const fname = card.diveToFile(false, dir, parser.string_arg);
+  if (!fname || !preflight.start(*dir, fname, false)) {
+    SERIAL_ECHOLN(F(STR_SD_OPEN_FILE_FAIL), parser.string_arg, C('.'));
+    return;
+  }
+
+  preflight.report();
+}
+
+#endif // PREFLIGHT_SCAN
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_LOOKAHEAD_STATS)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M721: Report the number of blocks the planner visits for each new block
+ *
+ *   R : Reset the counters after reporting
+ */
+void GcodeSuite::M721() {
+  const Planner::lookahead_stats_t &s = planner.lookahead_stats;
+  SERIAL_ECHOLNPGM(
+    "Lookahead: ", s.insertions, " blocks added, ",
+    p_float_t(s.insertions ? float(s.touched) / s.insertions : 0.0f, 2), " visited per block, peak ", s.peak
+  );
+  if (parser.seen_test('R')) planner.lookahead_stats.reset();
+}
+
+#endif // PLANNER_LOOKAHEAD_STATS
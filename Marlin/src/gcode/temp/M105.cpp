@@ -31,6 +31,8 @@ void GcodeSuite::M105() {
   const int8_t target_extruder = get_target_extruder_from_command();
   if (target_extruder < 0) return;
 
+  SERIAL_REPORT_SCOPE();
+
   SERIAL_ECHOPGM(STR_OK);
 
   #if HAS_TEMP_SENSOR
@@ -1408,7 +1408,11 @@
     #define STEPPER_PAGES 16
   #endif
   #ifndef STEPPER_PAGE_FORMAT
-    #define STEPPER_PAGE_FORMAT SP_4x2_256
+    #if ENABLED(DIRECT_STEPPING_SD)
+      #define STEPPER_PAGE_FORMAT SP_QS_256
+    #else
+      #define STEPPER_PAGE_FORMAT SP_4x2_256
+    #endif
   #endif
   #ifndef PAGE_MANAGER
     #define PAGE_MANAGER SerialPageManager
@@ -1523,6 +1527,14 @@
   #if ANY(BIQU_MICROPROBE_V1, BIQU_MICROPROBE_V2)
     #define FT_MOTION_DISABLE_FOR_PROBING 1
   #endif
+  // MarlinBio: Per-stepper trajectory channels, Z1-Z4 then E0-E3
+  #if ENABLED(FTM_STEPPER_CHANNELS)
+    #define FTM_Z_CHANNELS NUM_Z_STEPPERS
+    #define FTM_E_CHANNELS E_STEPPERS
+    #define FTM_CHANNELS (FTM_Z_CHANNELS + FTM_E_CHANNELS)
+  #else
+    #define FTM_CHANNELS 0
+  #endif
 #endif
 
 // Multi-Stepping Limit
@@ -73,6 +73,7 @@
   #undef SDCARD_EEPROM_EMULATION
   #undef SRAM_EEPROM_EMULATION
   #undef FLASH_EEPROM_EMULATION
+  #undef FLASH_EEPROM_RECORDS
   #undef IIC_BL24CXX_EEPROM
 #endif
 
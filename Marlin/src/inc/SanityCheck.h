@@ -252,6 +252,11 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+// MarlinBio: Reports are buffered in RAM
+#if defined(SERIAL_REPORT_BUFFER) && !WITHIN(SERIAL_REPORT_BUFFER, 32, 4096)
+  #error "SERIAL_REPORT_BUFFER must be from 32 to 4096 bytes."
+#endif
+
 /**
  * Multiple Stepper Drivers Per Axis
  */
@@ -431,6 +436,21 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #undef SD_CONNECTION_TYPICAL
 #endif
 
+/**
+ * Pre-flight scan requirements
+ */
+#if ENABLED(PREFLIGHT_SCAN)
+  #if !HAS_MEDIA
+    #error "PREFLIGHT_SCAN requires SD or USB media."
+  #elif !HAS_EXTRUDERS
+    #error "PREFLIGHT_SCAN requires at least one extruder."
+  #elif PREFLIGHT_SCAN_BYTES < 64
+    #error "PREFLIGHT_SCAN_BYTES must be at least 64."
+  #elif !WITHIN(PREFLIGHT_MARKS, 1, 255)
+    #error "PREFLIGHT_MARKS must be from 1 to 255."
+  #endif
+#endif
+
 /**
  * SD File Sorting
  */
@@ -875,6 +895,52 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 
 #endif // LIN_ADVANCE
 
+/**
+ * Syringe Flow Model requirements
+ */
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #if !HAS_EXTRUDERS
+    #error "SYRINGE_FLOW_MODEL requires at least one extruder."
+  #elif NONE(LIN_ADVANCE, FT_MOTION)
+    #error "SYRINGE_FLOW_MODEL requires LIN_ADVANCE or FT_MOTION."
+  #elif ENABLED(ADVANCE_K_EXTRA)
+    #error "SYRINGE_FLOW_MODEL is incompatible with ADVANCE_K_EXTRA."
+  #elif ENABLED(SYRINGE_CONSTANT_VOLUME) && DISABLED(LIN_ADVANCE)
+    #error "SYRINGE_CONSTANT_VOLUME requires LIN_ADVANCE."
+  #elif ENABLED(SYRINGE_CONSTANT_VOLUME) && ENABLED(SMOOTH_LIN_ADVANCE)
+    #error "SYRINGE_CONSTANT_VOLUME is not compatible with SMOOTH_LIN_ADVANCE."
+  #elif !WITHIN(SYRINGE_TAU_GAUGE, 14, 34)
+    #error "SYRINGE_TAU_GAUGE must be from 14 to 34."
+  #endif
+  constexpr uint8_t sfm_gauge[] = SYRINGE_NEEDLE_GAUGE;
+  static_assert(COUNT(sfm_gauge) <= EXTRUDERS, "The SYRINGE_NEEDLE_GAUGE array has too many elements (i.e., more than " STRINGIFY(EXTRUDERS) ").");
+  #define _SFM_ASSERT(N) static_assert(N >= COUNT(sfm_gauge) || !sfm_gauge[N] || WITHIN(sfm_gauge[N], 14, 34), "SYRINGE_NEEDLE_GAUGE values must be 0 or from 14 to 34.");
+  REPEAT(EXTRUDERS, _SFM_ASSERT)
+  #undef _SFM_ASSERT
+  constexpr float sfm_tau[] = SYRINGE_PRESSURE_TAU;
+  static_assert(COUNT(sfm_tau) <= EXTRUDERS, "The SYRINGE_PRESSURE_TAU array has too many elements (i.e., more than " STRINGIFY(EXTRUDERS) ").");
+  #define _SFM_ASSERT(N) static_assert(N >= COUNT(sfm_tau) || WITHIN(sfm_tau[N], 0, 10), "SYRINGE_PRESSURE_TAU values must be from 0 to 10.");
+  REPEAT(EXTRUDERS, _SFM_ASSERT)
+  #undef _SFM_ASSERT
+#endif
+
+/**
+ * Tool Motion Profiles requirements
+ */
+#if ENABLED(TOOL_MOTION_PROFILES)
+  #if !HAS_MULTI_EXTRUDER
+    #error "TOOL_MOTION_PROFILES requires more than one extruder."
+  #elif ANY(MIXING_EXTRUDER, DUAL_X_CARRIAGE, SWITCHING_EXTRUDER)
+    #error "TOOL_MOTION_PROFILES requires one extruder per tool (no MIXING_EXTRUDER, DUAL_X_CARRIAGE, or SWITCHING_EXTRUDER)."
+  #elif ENABLED(DISTINCT_E_FACTORS)
+    #error "TOOL_MOTION_PROFILES replaces DISTINCT_E_FACTORS. Disable DISTINCT_E_FACTORS."
+  #elif ENABLED(ADVANCE_K_EXTRA)
+    #error "TOOL_MOTION_PROFILES is incompatible with ADVANCE_K_EXTRA."
+  #elif DISABLED(EDITABLE_STEPS_PER_UNIT)
+    #error "TOOL_MOTION_PROFILES requires EDITABLE_STEPS_PER_UNIT."
+  #endif
+#endif
+
 /**
  * Nonlinear Extrusion requirements
  */
@@ -3567,6 +3633,20 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+// Syringe plunger auto-zero requirements
+#if ENABLED(SYRINGE_AUTO_ZERO)
+  #if !USE_SENSORLESS
+    #error "SYRINGE_AUTO_ZERO requires SENSORLESS_HOMING or SENSORLESS_PROBING."
+  #elif ANY(MIXING_EXTRUDER, SWITCHING_EXTRUDER, HAS_DUPLICATION_MODE, HAS_PRUSA_MMU2, HAS_PRUSA_MMU3)
+    #error "SYRINGE_AUTO_ZERO requires one E stepper per extruder."
+  #elif ENABLED(FT_MOTION) && DISABLED(FTM_STEPPER_CHANNELS)
+    #error "SYRINGE_AUTO_ZERO with FT_MOTION requires FTM_STEPPER_CHANNELS."
+  #elif !AXIS_DRIVER_TYPE_E0(TMC2209) || (E_STEPPERS > 1 && !AXIS_DRIVER_TYPE_E1(TMC2209)) \
+     || (E_STEPPERS > 2 && !AXIS_DRIVER_TYPE_E2(TMC2209)) || (E_STEPPERS > 3 && !AXIS_DRIVER_TYPE_E3(TMC2209)) || E_STEPPERS > 4
+    #error "SYRINGE_AUTO_ZERO requires TMC2209 drivers on E0-E3."
+  #endif
+#endif
+
 // Sensorless homing is required for both combined steppers in an H-bot
 #if CORE_IS_XY && X_SENSORLESS != Y_SENSORLESS
   #error "CoreXY requires both X and Y to use sensorless homing if either one does."
@@ -3870,6 +3950,10 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "BLOCK_BUFFER_SIZE must be non-zero."
 #elif BLOCK_BUFFER_SIZE > 64
   #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
+#elif ENABLED(RUNTIME_BLOCK_BUFFER) && !IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
+  #error "RUNTIME_BLOCK_BUFFER requires BLOCK_BUFFER_SIZE to be a power of 2."
+#elif ENABLED(RUNTIME_BLOCK_BUFFER) && !defined(BLOCK_BUFFER_RAM_BUDGET)
+  #error "RUNTIME_BLOCK_BUFFER requires BLOCK_BUFFER_RAM_BUDGET."
 #endif
 
 #if ENABLED(LED_CONTROL_MENU) && NONE(HAS_MARLINUI_MENU, DWIN_LCD_PROUI)
@@ -3902,6 +3986,16 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "X_AXIS_TWIST_COMPENSATION is incompatible with NOZZLE_AS_PROBE."
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "POWER_LOSS_JOURNAL requires POWER_LOSS_RECOVERY."
+  #elif !WITHIN(POWER_LOSS_JOURNAL_COMMANDS, 1, 255)
+    #error "POWER_LOSS_JOURNAL_COMMANDS must be from 1 to 255."
+  #elif !WITHIN(POWER_LOSS_JOURNAL_RECORDS, 1, 4096)
+    #error "POWER_LOSS_JOURNAL_RECORDS must be from 1 to 4096."
+  #endif
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #if ENABLED(BACKUP_POWER_SUPPLY) && !PIN_EXISTS(POWER_LOSS)
     #error "BACKUP_POWER_SUPPLY requires a POWER_LOSS_PIN."
@@ -3987,6 +4081,16 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "GRADIENT_MIX requires 2 or more MIXING_VIRTUAL_TOOLS."
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+  #if DISABLED(CANCEL_OBJECTS)
+    #error "CANCEL_OBJECTS_SEEK requires CANCEL_OBJECTS."
+  #elif !HAS_MEDIA
+    #error "CANCEL_OBJECTS_SEEK requires SDSUPPORT or USB_FLASH_DRIVE_SUPPORT."
+  #elif CANCEL_OBJECTS_SEEK_BYTES < 512
+    #error "CANCEL_OBJECTS_SEEK_BYTES must be at least 512."
+  #endif
+#endif
+
 /**
  * Photo G-code requirements
  */
@@ -4002,6 +4106,17 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #elif defined(PHOTO_RETRACT_MM)
     static_assert(PHOTO_RETRACT_MM + 0 >= 0, "PHOTO_RETRACT_MM must be >= 0.");
   #endif
+  #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+    #if DISABLED(OUTPUT_EVENT_BLOCKS)
+      #error "CAMERA_CAPTURE_SCHEDULER requires OUTPUT_EVENT_BLOCKS."
+    #elif !PIN_EXISTS(CHDK)
+      #error "CAMERA_CAPTURE_SCHEDULER requires CHDK_PIN."
+    #elif IS_KINEMATIC || IS_CORE
+      #error "CAMERA_CAPTURE_SCHEDULER only reports Cartesian positions."
+    #elif !WITHIN(CAMERA_CAPTURE_STAMPS, 2, 255)
+      #error "CAMERA_CAPTURE_STAMPS must be from 2 to 255."
+    #endif
+  #endif
 #endif
 
 /**
@@ -4168,6 +4283,18 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+#if ENABLED(UV_EXPOSURE_HEAD)
+  #if !defined(UV_EXPOSURE_CHANNELS) || !defined(UV_EXPOSURE_PINS) || !defined(UV_EXPOSURE_DOSE)
+    #error "UV_EXPOSURE_HEAD requires UV_EXPOSURE_CHANNELS, UV_EXPOSURE_PINS, and UV_EXPOSURE_DOSE."
+  #elif !WITHIN(UV_EXPOSURE_CHANNELS, 1, 8)
+    #error "UV_EXPOSURE_CHANNELS must be from 1 to 8."
+  #elif ENABLED(FT_MOTION)
+    #error "UV_EXPOSURE_HEAD is not yet compatible with FT_MOTION."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "UV_EXPOSURE_HEAD is not compatible with DIRECT_STEPPING."
+  #endif
+#endif
+
 #if HAS_ADC_BUTTONS && defined(ADC_BUTTON_DEBOUNCE_DELAY) && ADC_BUTTON_DEBOUNCE_DELAY < 16
   #error "ADC_BUTTON_DEBOUNCE_DELAY must be greater than 16."
 #endif
@@ -4486,10 +4613,12 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
  * Direct Stepping requirements
  */
 #if ENABLED(DIRECT_STEPPING)
-  #ifdef CPU_32_BIT
-    #error "Direct Stepping is not supported on 32-bit boards."
+  #if defined(CPU_32_BIT) && DISABLED(DIRECT_STEPPING_SD)
+    #error "DIRECT_STEPPING on a 32-bit board requires DIRECT_STEPPING_SD. The serial page protocol is AVR-only."
   #elif !IS_FULL_CARTESIAN
     #error "Direct Stepping is incompatible with enabled kinematics."
+  #elif ENABLED(DIRECT_STEPPING_SD) && !HAS_MEDIA
+    #error "DIRECT_STEPPING_SD requires SDSUPPORT or USB_FLASH_DRIVE_SUPPORT."
   #endif
 #endif
 
@@ -4577,6 +4706,13 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "FT_MOTION does not currently support MIXING_EXTRUDER."
   #elif DISABLED(FTM_UNIFIED_BWS)
     #error "FT_MOTION requires FTM_UNIFIED_BWS to be enabled because FBS is not yet implemented."
+  #elif ENABLED(FTM_STEPPER_CHANNELS) && ANY(SWITCHING_EXTRUDER, HAS_DUPLICATION_MODE, HAS_PRUSA_MMU2, HAS_PRUSA_MMU3)
+    #error "FTM_STEPPER_CHANNELS requires one E stepper per extruder."
+  #elif ENABLED(FTM_STEPPER_CHANNELS) && ANY(CORE_IS_XZ, CORE_IS_YZ)
+    #error "FTM_STEPPER_CHANNELS is not compatible with CoreXZ or CoreYZ kinematics."
+  #endif
+  #if ENABLED(FTM_STEPPER_CHANNELS) && 2 * (LOGICAL_AXES + FTM_CHANNELS) > 32
+    #error "FTM_STEPPER_CHANNELS supports up to 32 FT Motion command bits."
   #endif
   #if !HAS_X_AXIS
     static_assert(FTM_DEFAULT_SHAPER_X != ftMotionShaper_NONE, "Without any linear axes FTM_DEFAULT_SHAPER_X must be ftMotionShaper_NONE.");
@@ -4589,6 +4725,69 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+/**
+ * Native arc blocks
+ */
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  #if DISABLED(FT_MOTION)
+    #error "ARC_NATIVE_BLOCKS requires FT_MOTION."
+  #elif !HAS_JUNCTION_DEVIATION
+    #error "ARC_NATIVE_BLOCKS requires JUNCTION_DEVIATION."
+  #elif IS_KINEMATIC || IS_CORE || ANY(MARKFORGED_XY, MARKFORGED_YX)
+    #error "ARC_NATIVE_BLOCKS requires Cartesian XY kinematics."
+  #elif !WITHIN(ARC_NATIVE_MAX_SWEEP, 10, 180)
+    #error "ARC_NATIVE_MAX_SWEEP must be between 10 and 180."
+  #endif
+#endif
+
+/**
+ * Segment coalescing
+ */
+#if ENABLED(SEGMENT_COALESCING)
+  #if IS_KINEMATIC
+    #error "SEGMENT_COALESCING is not compatible with kinematic machines."
+  #elif NUM_AXES > XYZ
+    #error "SEGMENT_COALESCING does not support more than 3 axes (i.e., XYZ)."
+  #elif !WITHIN(COALESCE_MIN_QUEUED, 2, BLOCK_BUFFER_SIZE - 1)
+    #error "COALESCE_MIN_QUEUED must be between 2 and BLOCK_BUFFER_SIZE - 1."
+  #endif
+  static_assert(WITHIN(COALESCE_MAX_ANGLE, 0, 10), "COALESCE_MAX_ANGLE must be between 0 and 10.");
+  static_assert(COALESCE_E_RATIO_TOL >= 0 && COALESCE_FEEDRATE_TOL >= 0, "COALESCE_E_RATIO_TOL and COALESCE_FEEDRATE_TOL must be 0 or greater.");
+  static_assert(COALESCE_MAX_LENGTH > 0, "COALESCE_MAX_LENGTH must be greater than 0.");
+#endif
+
+#if ENABLED(E_ONLY_FAST_PATH) && !HAS_EXTRUDERS
+  #error "E_ONLY_FAST_PATH requires at least one extruder."
+#endif
+
+#if ENABLED(TOOLCHANGE_SYNC_BLOCK)
+  #if !HAS_MULTI_EXTRUDER
+    #error "TOOLCHANGE_SYNC_BLOCK requires more than one extruder."
+  #elif IS_KINEMATIC
+    #error "TOOLCHANGE_SYNC_BLOCK is not compatible with kinematic machines."
+  #elif NONE(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
+    #error "TOOLCHANGE_SYNC_BLOCK requires Z_MULTI_ENDSTOPS or Z_STEPPER_AUTO_ALIGN for the Z locks."
+  #elif ANY(MIXING_EXTRUDER, DUAL_X_CARRIAGE, PARKING_EXTRUDER, MAGNETIC_PARKING_EXTRUDER, SWITCHING_TOOLHEAD, MAGNETIC_SWITCHING_TOOLHEAD, ELECTROMAGNETIC_SWITCHING_TOOLHEAD)
+    #error "TOOLCHANGE_SYNC_BLOCK is not compatible with tool changers that park or mix."
+  #elif ANY(SWITCHING_EXTRUDER, SWITCHING_NOZZLE, MECHANICAL_SWITCHING_EXTRUDER, MECHANICAL_SWITCHING_NOZZLE, EXT_SOLENOID, TOOL_SENSOR, HAS_FANMUX, HAS_PRUSA_MMU1)
+    #error "TOOLCHANGE_SYNC_BLOCK is not compatible with tool changes that need the machine to stop."
+  #elif ENABLED(FT_MOTION) && DISABLED(FTM_STEPPER_CHANNELS)
+    #error "TOOLCHANGE_SYNC_BLOCK with FT_MOTION requires FTM_STEPPER_CHANNELS."
+  #endif
+#endif
+
+/**
+ * Adaptive curve segments
+ */
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+  #if ARC_SEGMENTS_PER_SEC
+    #error "ADAPTIVE_CURVE_SEGMENTS replaces ARC_SEGMENTS_PER_SEC. Disable one of them."
+  #endif
+  static_assert(CURVE_CHORD_TOLERANCE > 0, "CURVE_CHORD_TOLERANCE must be greater than 0.");
+  static_assert(BEZIER_CHORD_TOLERANCE > 0, "BEZIER_CHORD_TOLERANCE must be greater than 0.");
+  static_assert(CURVE_SEGMENT_STRETCH >= 1, "CURVE_SEGMENT_STRETCH must be 1 or greater.");
+#endif
+
 // Multi-Stepping Limit
 static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING_LIMIT), "MULTISTEPPING_LIMIT must be 1, 2, 4, 8, 16, 32, 64, or 128.");
 
@@ -4619,7 +4619,7 @@ void JyersDWIN::printScreenControl() {
               #if HAS_EXTRUDERS
                 gcode.process_subcommands_now(TS(F("M109 S"), pausetemp));
               #endif
-              TERN_(HAS_FAN, thermalManager.fan_speed[0] = pausefan);
+              TERN_(HAS_FAN, thermalManager.set_fan_speed(0, pausefan));
               planner.synchronize();
               TERN_(HAS_MEDIA, queue.inject(FPSTR(M24_STR)));
             #endif
@@ -148,6 +148,7 @@ void DGUSScreenHandler::percentageToUint8(DGUS_VP_Variable &var, void *val_ptr)
   if (var.memadr) {
     const uint16_t value = BE16_P(val_ptr);
     *(uint8_t*)var.memadr = map(constrain(value, 0, 100), 0, 100, 0, 255);
+    planner.mark_block_state_changed(); // In case it's a fan speed
   }
 }
 
@@ -552,6 +553,7 @@ void DGUSScreenHandler::handleSettings(DGUS_VP_Variable &var, void *val_ptr) {
 #if HAS_FAN
   void DGUSScreenHandler::handleFanControl(DGUS_VP_Variable &var, void *val_ptr) {
     *(uint8_t*)var.memadr = *(uint8_t*)var.memadr > 0 ? 0 : 255;
+    planner.mark_block_state_changed();
   }
 #endif
 
@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * module/coalescer.cpp - Merge runs of collinear short moves before the planner
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SEGMENT_COALESCING)
+
+#include "coalescer.h"
+#include "motion.h"
+#include "planner.h"
+#include "../gcode/queue.h"
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  #include "../feature/powerloss.h"
+#endif
+
+SegmentCoalescer coalescer;
+
+bool SegmentCoalescer::held; // = false
+xyze_pos_t SegmentCoalescer::start, SegmentCoalescer::end;
+feedRate_t SegmentCoalescer::feedrate;
+uint8_t SegmentCoalescer::extruder;
+#if ENABLED(POWER_LOSS_RECOVERY)
+  bool SegmentCoalescer::flushing; // = false
+  uint32_t SegmentCoalescer::held_sdpos;
+#endif
+const float SegmentCoalescer::min_cos = cos(RADIANS(COALESCE_MAX_ANGLE));
+
+bool SegmentCoalescer::continues(const xyze_pos_t &target, const_feedRate_t fr_mm_s) {
+  if (extruder != active_extruder) return false;
+  if (ABS(fr_mm_s - feedrate) > (COALESCE_FEEDRATE_TOL) * feedrate) return false;
+
+  // Compare the new move with the whole run, so the error can't creep
+  const xyz_pos_t run = end - start, step = target - end;
+  const float run_mm = run.magnitude(), step_mm = step.magnitude();
+
+  #if ENABLED(E_ONLY_FAST_PATH)
+    // A run of E-only moves continues while E keeps its direction
+    if (!run_mm) {
+      const float run_e = end.e - start.e, step_e = target.e - end.e;
+      return !step_mm && run_e * step_e > 0 && ABS(run_e + step_e) <= (COALESCE_MAX_LENGTH);
+    }
+  #endif
+
+  if (!step_mm || run_mm + step_mm > (COALESCE_MAX_LENGTH)) return false;
+  if (run.x * step.x + run.y * step.y + run.z * step.z < min_cos * run_mm * step_mm) return false;
+
+  #if HAS_EXTRUDERS
+    const float run_e_per_mm = (end.e - start.e) / run_mm,
+                step_e_per_mm = (target.e - end.e) / step_mm;
+    if (ABS(step_e_per_mm - run_e_per_mm) > (COALESCE_E_RATIO_TOL) * ABS(run_e_per_mm)) return false;
+  #endif
+
+  return true;
+}
+
+void SegmentCoalescer::line_to(const xyze_pos_t &target, const_feedRate_t fr_mm_s) {
+  if (held && continues(target, fr_mm_s)) { end = target; return; }
+
+  flush();
+
+  // Hold only XYZ moves (or E-only moves), and only while the planner has plenty to do
+  const xyze_pos_t move = target - current_position;
+  float move_mm = xyz_pos_t(move).magnitude();
+  TERN_(E_ONLY_FAST_PATH, if (!move_mm) move_mm = ABS(move.e));
+  if (move_mm && move_mm < (COALESCE_MAX_LENGTH) && planner.movesplanned() >= (COALESCE_MIN_QUEUED)) {
+    held = true;
+    start = current_position;
+    end = target;
+    feedrate = fr_mm_s;
+    extruder = active_extruder;
+    TERN_(POWER_LOSS_RECOVERY, held_sdpos = recovery.command_sdpos());
+  }
+  else
+    planner.buffer_line(target, fr_mm_s);
+}
+
+void SegmentCoalescer::flush() {
+  if (!held) return;
+  held = false; // Clear first, since the planner flushes before any new block
+  TERN_(POWER_LOSS_RECOVERY, flushing = true);
+  planner.buffer_line(end, feedrate, extruder);
+  TERN_(POWER_LOSS_RECOVERY, flushing = false);
+}
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  uint32_t SegmentCoalescer::command_sdpos() { return flushing ? held_sdpos : recovery.command_sdpos(); }
+#endif
+
+void SegmentCoalescer::task() {
+  if (held && (planner.movesplanned() < (COALESCE_MIN_QUEUED) || !queue.has_commands_queued()))
+    flush();
+}
+
+#endif // SEGMENT_COALESCING
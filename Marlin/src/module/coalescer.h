@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * module/coalescer.h - Merge runs of collinear short moves before the planner
+ *
+ * Slicers and path generators may split a straight line into many tiny
+ * moves. Each one costs a planner block and a lookahead pass. While the
+ * planner has enough queued, the last G0/G1 move is held back and each
+ * following move that continues it is folded in. A move continues the held
+ * move when the direction, E per mm and feedrate are all within tolerance.
+ * With E_ONLY_FAST_PATH, E-only moves that keep E's direction are merged too.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/types.h"
+
+class SegmentCoalescer {
+public:
+  // Queue a linear move from current_position, or fold it into the held move
+  static void line_to(const xyze_pos_t &target, const_feedRate_t fr_mm_s);
+
+  // Send the held move to the planner
+  static void flush();
+
+  // Drop the held move, e.g., on quick stop
+  static void discard() { held = false; }
+
+  static bool has_held_move() { return held; }
+
+  // Flush once the planner runs low or no more commands are waiting
+  static void task();
+
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    // File position for a new block. A held move resumes at its first command.
+    static uint32_t command_sdpos();
+  #endif
+
+private:
+  static bool held;
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    static bool flushing;
+    static uint32_t held_sdpos;
+  #endif
+  static const float min_cos;
+  static xyze_pos_t start, end;
+  static feedRate_t feedrate;
+  static uint8_t extruder;
+
+  static bool continues(const xyze_pos_t &target, const_feedRate_t fr_mm_s);
+};
+
+extern SegmentCoalescer coalescer;
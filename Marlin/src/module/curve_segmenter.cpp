@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * module/curve_segmenter.cpp - Segment lengths for G2/G3 arcs and G5 Bézier curves
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+
+#include "curve_segmenter.h"
+#include "planner.h"
+
+#ifndef MIN_ARC_SEGMENT_MM
+  #define MIN_ARC_SEGMENT_MM 0.1
+#endif
+#ifndef MAX_ARC_SEGMENT_MM
+  #define MAX_ARC_SEGMENT_MM 1.0
+#endif
+
+CurveSegmenter curve_segmenter;
+
+curve_segmenter_settings_t CurveSegmenter::settings;
+
+void CurveSegmenter::reset() {
+  settings.tolerance = CURVE_CHORD_TOLERANCE;
+  settings.bezier_tolerance = BEZIER_CHORD_TOLERANCE;
+  settings.stretch = CURVE_SEGMENT_STRETCH;
+}
+
+float CurveSegmenter::max_segment_mm() {
+  // Stretch linearly from a half-full to a full planner
+  const block_index_t half = (BLOCK_BUFFER_COUNT) / 2,
+                      queued = planner.movesplanned();
+  float factor = 1.0f;
+  if (queued > half)
+    factor += (settings.stretch - 1.0f) * float(queued - half) / float((BLOCK_BUFFER_COUNT) - half);
+  return (MAX_ARC_SEGMENT_MM) * factor;
+}
+
+float CurveSegmenter::segment_mm(const_float_t radius) {
+  const float tol = settings.tolerance;
+  if (radius <= tol) return MIN_ARC_SEGMENT_MM;
+  const float chord = 2.0f * SQRT(tol * (2.0f * radius - tol));
+  return constrain(chord, MIN_ARC_SEGMENT_MM, max_segment_mm());
+}
+
+#endif // ADAPTIVE_CURVE_SEGMENTS
@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * module/curve_segmenter.h - Segment lengths for G2/G3 arcs and G5 Bézier curves
+ *
+ * A chord of length L across a curve of radius r strays from the curve by
+ * r - sqrt(r^2 - (L/2)^2). Holding that under a tolerance keeps small features
+ * accurate while gentle curves get long segments. When the planner is nearly
+ * full the longest allowed segment is stretched, so long sweeps queue fewer blocks.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+typedef struct {
+  float tolerance;        // M719 S - (mm) Max deviation of an arc segment from the arc
+  float bezier_tolerance; // M719 B - (mm) Max deviation of a Bézier segment from the curve
+  float stretch;          // M719 R - Max segment length factor with a full planner
+} curve_segmenter_settings_t;
+
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+
+class CurveSegmenter {
+public:
+  static curve_segmenter_settings_t settings;
+
+  CurveSegmenter() { reset(); }
+
+  static void reset();
+
+  // (mm) Longest segment allowed with the current planner fill
+  static float max_segment_mm();
+
+  // (mm) Longest chord of a curve with the given radius that stays within tolerance
+  static float segment_mm(const_float_t radius);
+};
+
+extern CurveSegmenter curve_segmenter;
+
+#endif // ADAPTIVE_CURVE_SEGMENTS
@@ -457,6 +457,7 @@ void Endstops::event_handler() {
 #endif
 
 void __O2 Endstops::report_states() {
+  SERIAL_REPORT_SCOPE();
   TERN_(BLTOUCH, bltouch._set_SW_mode());
   SERIAL_ECHOLNPGM(STR_M119_REPORT);
   #define ES_REPORT(S) print_es_state(READ_ENDSTOP(S##_PIN) == S##_ENDSTOP_HIT_STATE, F(STR_##S))
@@ -805,9 +806,20 @@ void Endstops::update() {
     } \
   }while(0)
 
+  // MarlinBio: Latch multi-Z hits so a motor stopped by StallGuard stays stopped once its DIAG releases
+  #define _SEPARATE_LATCH(A,H) _SEPARATE_LATCH_##A(H)
+  #define _SEPARATE_LATCH_X(H) NOOP
+  #define _SEPARATE_LATCH_Y(H) NOOP
+  #if ENABLED(Z_MULTI_ENDSTOPS)
+    #define _SEPARATE_LATCH_Z(H) do{ if (stepper.separate_multi_axis) H = stepper.latch_z_stops(H); }while(0)
+  #else
+    #define _SEPARATE_LATCH_Z(H) NOOP
+  #endif
+
   // Call the endstop triggered routine for dual endstops
   #define PROCESS_DUAL_ENDSTOP(A, MINMAX) do { \
-    const byte dual_hit = TEST_ENDSTOP(ES_ENUM(A, MINMAX)) | (TEST_ENDSTOP(ES_ENUM(A##2, MINMAX)) << 1); \
+    byte dual_hit = TEST_ENDSTOP(ES_ENUM(A, MINMAX)) | (TEST_ENDSTOP(ES_ENUM(A##2, MINMAX)) << 1); \
+    _SEPARATE_LATCH(A, dual_hit); \
     if (dual_hit) { \
       _ENDSTOP_HIT(A, MINMAX); \
       /* if not performing home or if both endstops were triggered during homing... */ \
@@ -817,7 +829,8 @@ void Endstops::update() {
   }while(0)
 
   #define PROCESS_TRIPLE_ENDSTOP(A, MINMAX) do { \
-    const byte triple_hit = TEST_ENDSTOP(ES_ENUM(A, MINMAX)) | (TEST_ENDSTOP(ES_ENUM(A##2, MINMAX)) << 1) | (TEST_ENDSTOP(ES_ENUM(A##3, MINMAX)) << 2); \
+    byte triple_hit = TEST_ENDSTOP(ES_ENUM(A, MINMAX)) | (TEST_ENDSTOP(ES_ENUM(A##2, MINMAX)) << 1) | (TEST_ENDSTOP(ES_ENUM(A##3, MINMAX)) << 2); \
+    _SEPARATE_LATCH(A, triple_hit); \
     if (triple_hit) { \
       _ENDSTOP_HIT(A, MINMAX); \
       /* if not performing home or if both endstops were triggered during homing... */ \
@@ -827,7 +840,8 @@ void Endstops::update() {
   }while(0)
 
   #define PROCESS_QUAD_ENDSTOP(A, MINMAX) do { \
-    const byte quad_hit = TEST_ENDSTOP(ES_ENUM(A, MINMAX)) | (TEST_ENDSTOP(ES_ENUM(A##2, MINMAX)) << 1) | (TEST_ENDSTOP(ES_ENUM(A##3, MINMAX)) << 2) | (TEST_ENDSTOP(ES_ENUM(A##4, MINMAX)) << 3); \
+    byte quad_hit = TEST_ENDSTOP(ES_ENUM(A, MINMAX)) | (TEST_ENDSTOP(ES_ENUM(A##2, MINMAX)) << 1) | (TEST_ENDSTOP(ES_ENUM(A##3, MINMAX)) << 2) | (TEST_ENDSTOP(ES_ENUM(A##4, MINMAX)) << 3); \
+    _SEPARATE_LATCH(A, quad_hit); \
     if (quad_hit) { \
       _ENDSTOP_HIT(A, MINMAX); \
       /* if not performing home or if both endstops were triggered during homing... */ \
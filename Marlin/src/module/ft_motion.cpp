@@ -28,6 +28,10 @@
 #include "stepper.h" // Access stepper block queue function and abort status.
 #include "endstops.h"
 
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #include "../feature/syringe_flow.h"
+#endif
+
 FTMotion ftMotion;
 
 //-----------------------------------------------------------------
@@ -67,6 +71,10 @@ bool FTMotion::batchRdyForInterp = false;       // Indicates the batch is done b
 xyze_pos_t   FTMotion::startPosn,                     // (mm) Start position of block
              FTMotion::endPosn_prevBlock = { 0.0f };  // (mm) End position of previous block
 xyze_float_t FTMotion::ratio;                         // (ratio) Axis move ratio of block
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  float FTMotion::arc_sweep_per_mm = 0.0f;              // (rad/mm) Sweep of a curved block per mm of travel
+  xy_float_t FTMotion::arc_rvec;                        // (mm) Vector from the arc center to the start of the block
+#endif
 float FTMotion::accel_P,                        // Acceleration prime of block. [mm/sec/sec]
       FTMotion::decel_P,                        // Deceleration prime of block. [mm/sec/sec]
       FTMotion::F_P,                            // Feedrate prime of block. [mm/sec]
@@ -89,6 +97,15 @@ xyze_long_t FTMotion::steps = { 0 };            // Step count accumulator.
 
 uint32_t FTMotion::interpIdx = 0;               // Index of current data point being interpolated.
 
+#if ENABLED(FTM_STEPPER_CHANNELS)
+  float FTMotion::chTraj[FTM_CHANNELS][FTM_WINDOW_SIZE],  // Storage for the trajectory of each stepper.
+        FTMotion::chTrajMod[FTM_CHANNELS][FTM_BATCH_SIZE],// Storage for the trajectory window of each stepper.
+        FTMotion::chStartPosn[FTM_CHANNELS],              // (mm) Start position of block
+        FTMotion::chEndPosn_prevBlock[FTM_CHANNELS],      // (mm) End position of previous block
+        FTMotion::chRatio[FTM_CHANNELS];                  // (ratio) Stepper move ratio of block
+  int32_t FTMotion::chSteps[FTM_CHANNELS];                // Step count accumulators.
+#endif
+
 // Shaping variables.
 #if HAS_FTM_SHAPING
   FTMotion::shaping_t FTMotion::shaping = {
@@ -106,6 +123,14 @@ uint32_t FTMotion::interpIdx = 0;               // Index of current data point b
   // Linear advance variables.
   float FTMotion::e_raw_z1 = 0.0f;        // (ms) Unit delay of raw extruder position.
   float FTMotion::e_advanced_z1 = 0.0f;   // (ms) Unit delay of advanced extruder position.
+  #if ENABLED(SYRINGE_FLOW_MODEL)
+    float FTMotion::e_advance_gain = 0.0f;  // (s) Syringe pressure time constant times the E ratio of the block.
+  #endif
+  #if ENABLED(FTM_STEPPER_CHANNELS)
+    float FTMotion::ch_e_raw_z1[FTM_E_CHANNELS],        // Unit delay of raw syringe positions.
+          FTMotion::ch_e_advanced_z1[FTM_E_CHANNELS],   // Unit delay of advanced syringe positions.
+          FTMotion::ch_e_advance_gain[FTM_E_CHANNELS];  // Linear advance gain of each syringe for the block.
+  #endif
 #endif
 
 constexpr uint32_t BATCH_SIDX_IN_WINDOW = (FTM_WINDOW_SIZE) - (FTM_BATCH_SIZE); // Batch start index in window.
@@ -139,11 +164,27 @@ void FTMotion::loop() {
     if (stepper.current_block->is_sync()) {     // Sync block?
       if (stepper.current_block->is_sync_pos()) // Position sync? Set the position.
         stepper._set_position(stepper.current_block->position);
+      #if ENABLED(COMPACT_PLANNER_BLOCKS)
+        if (stepper.current_block->is_sync_state()) // Fans, mixer, etc.
+          planner.apply_block_state(planner.state_of(stepper.current_block));
+      #endif
+      #if ENABLED(TOOLCHANGE_SYNC_BLOCK)
+        // Z locks for the new tool. The Z channels read the locks as each block loads,
+        // so the trajectories already made for earlier blocks keep the old tool's Z motor.
+        if (stepper.current_block->is_sync_tool())
+          stepper.set_all_z_lock(true, stepper.current_block->extruder);
+      #endif
+      #if ENABLED(OUTPUT_EVENT_BLOCKS)
+        if (stepper.current_block->is_sync_output()) // Queued pin change
+          stepper.current_block->output.apply();
+      #endif
       discard_planner_block_protected();
       continue;
     }
     loadBlockData(stepper.current_block);
     blockProcRdy = true;
+    // Trajectories are computed ahead of the steppers, so a change within the move applies as it loads
+    TERN_(OUTPUT_EVENT_BLOCKS, if (stepper.current_block->has_output()) stepper.current_block->output.apply());
     // Some kinematics track axis motion in HX, HY, HZ
     #if ANY(CORE_IS_XY, CORE_IS_XZ, MARKFORGED_XY, MARKFORGED_YX)
       stepper.last_direction_bits.hx = stepper.current_block->direction_bits.hx;
@@ -167,7 +208,7 @@ void FTMotion::loop() {
       discard_planner_block_protected();
 
       // Check if the block needs to be runout:
-      if (!batchRdy && !planner.has_blocks_queued()) {
+      if (!batchRdy && !planner.has_buffered_blocks()) {
         runoutBlock();
         makeVector(); // Do an additional makeVector call to guarantee batchRdy set this loop.
       }
@@ -181,6 +222,7 @@ void FTMotion::loop() {
 
     #if ENABLED(FTM_UNIFIED_BWS)
       trajMod = traj; // Move the window to traj
+      TERN_(FTM_STEPPER_CHANNELS, memcpy(chTrajMod, chTraj, sizeof(chTrajMod)));
     #else
       // Copy the uncompensated vectors.
       #define TCOPY(A) memcpy(trajMod.A, traj.A, sizeof(trajMod.A));
@@ -189,6 +231,13 @@ void FTMotion::loop() {
       // Shift the time series back in the window
       #define TSHIFT(A) memcpy(traj.A, &traj.A[FTM_BATCH_SIZE], BATCH_SIDX_IN_WINDOW * sizeof(traj.A[0]));
       LOGICAL_AXIS_MAP_LC(TSHIFT);
+
+      #if ENABLED(FTM_STEPPER_CHANNELS)
+        for (uint8_t c = 0; c < FTM_CHANNELS; ++c) {
+          memcpy(chTrajMod[c], chTraj[c], sizeof(chTrajMod[c]));
+          memcpy(chTraj[c], &chTraj[c][FTM_BATCH_SIZE], BATCH_SIDX_IN_WINDOW * sizeof(chTraj[c][0]));
+        }
+      #endif
     #endif
 
     // ... data is ready in trajMod.
@@ -390,6 +439,16 @@ void FTMotion::reset() {
 
   TERN_(HAS_EXTRUDERS, e_raw_z1 = e_advanced_z1 = 0.0f);
 
+  #if ENABLED(FTM_STEPPER_CHANNELS)
+    ZERO(chTraj);
+    ZERO(chEndPosn_prevBlock);
+    ZERO(chSteps);
+    #if HAS_EXTRUDERS
+      ZERO(ch_e_raw_z1);
+      ZERO(ch_e_advanced_z1);
+    #endif
+  #endif
+
   axis_move_end_ti.reset();
 }
 
@@ -408,6 +467,37 @@ void FTMotion::discard_planner_block_protected() {
   }
 }
 
+#if ENABLED(FTM_STEPPER_CHANNELS)
+
+  // MarlinBio: Locked Z motors hold still, except while homing them to separate endstops.
+  bool FTMotion::z_channel_moves(const uint8_t c) {
+    #if ANY(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
+      if (stepper.separate_multi_axis) return true;
+      switch (c) {
+        case 0: return !stepper.locked_Z_motor;
+        case 1: return !stepper.locked_Z2_motor;
+        #if NUM_Z_STEPPERS >= 3
+          case 2: return !stepper.locked_Z3_motor;
+          #if NUM_Z_STEPPERS >= 4
+            case 3: return !stepper.locked_Z4_motor;
+          #endif
+        #endif
+      }
+    #endif
+    UNUSED(c);
+    return true;
+  }
+
+  // MarlinBio: E moves the syringe of the block, or all the syringes being zeroed together.
+  bool FTMotion::e_channel_moves(const uint8_t c, const uint8_t extruder) {
+    #if ENABLED(SYRINGE_AUTO_ZERO)
+      if (stepper.separate_e_axes) return TEST(stepper.e_separate_mask, c);
+    #endif
+    return c == extruder;
+  }
+
+#endif // FTM_STEPPER_CHANNELS
+
 /**
  * Set up a pseudo block to allow motion to settle and buffers to empty.
  * Called when the planner has one block left. The buffers will be filled
@@ -419,6 +509,12 @@ void FTMotion::runoutBlock() {
 
   startPosn = endPosn_prevBlock;
   ratio.reset();
+  TERN_(ARC_NATIVE_BLOCKS, arc_sweep_per_mm = 0.0f);
+
+  #if ENABLED(FTM_STEPPER_CHANNELS)
+    COPY(chStartPosn, chEndPosn_prevBlock);
+    ZERO(chRatio);
+  #endif
 
   const int32_t n_to_fill_batch = (FTM_WINDOW_SIZE) - makeVector_batchIdx;
 
@@ -454,7 +550,8 @@ void FTMotion::init() {
 // Load / convert block data from planner to fixed-time control variables.
 void FTMotion::loadBlockData(block_t * const current_block) {
 
-  const float totalLength = current_block->millimeters,
+  const block_plan_t &plan = planner.plan_of(current_block);
+  const float totalLength = plan.millimeters,
               oneOverLength = 1.0f / totalLength;
 
   startPosn = endPosn_prevBlock;
@@ -473,6 +570,31 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   ratio = moveDist * oneOverLength;
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // MarlinBio: A curved block sweeps X and Y around its center instead of along the chord
+    arc_sweep_per_mm = plan.arc_sweep * oneOverLength;
+    arc_rvec = plan.arc_rvec;
+  #endif
+
+  // Lead the plunger by tau * (E acceleration) to cancel the syringe pressure lag.
+  TERN_(SYRINGE_FLOW_MODEL, e_advance_gain = syringe_flow.advance_tau(current_block->extruder) * ratio.e);
+
+  #if ENABLED(FTM_STEPPER_CHANNELS)
+    // MarlinBio: Route the Z and E motion of the block to the steppers that take part in it
+    COPY(chStartPosn, chEndPosn_prevBlock);
+    for (uint8_t c = 0; c < FTM_Z_CHANNELS; ++c)
+      chRatio[c] = z_channel_moves(c) ? ratio.z : 0.0f;
+    #if HAS_EXTRUDERS
+      for (uint8_t e = 0; e < FTM_E_CHANNELS; ++e) {
+        const float r = e_channel_moves(e, current_block->extruder) ? ratio.e : 0.0f;
+        chRatio[FTM_Z_CHANNELS + e] = r;
+        ch_e_advance_gain[e] = TERN(SYRINGE_FLOW_MODEL, syringe_flow.advance_tau(e) * r, cfg.linearAdvK * 0.0001f);
+      }
+    #endif
+    for (uint8_t c = 0; c < FTM_CHANNELS; ++c)
+      chEndPosn_prevBlock[c] += chRatio[c] * totalLength;
+  #endif
+
   const float spm = totalLength / current_block->step_event_count;  // (steps/mm) Distance for each step
 
   f_s = spm * current_block->initial_rate;              // (steps/s) Start feedrate
@@ -501,10 +623,10 @@ void FTMotion::loadBlockData(block_t * const current_block) {
               T3 = (F_n - f_e) / a;                     // (s) Decel Time = difference in feedrate over acceleration
   */
 
-  const float accel = current_block->acceleration,
+  const float accel = plan.acceleration,
               oneOverAccel = 1.0f / accel;
 
-  float F_n = current_block->nominal_speed;
+  float F_n = plan.nominal_speed;
   const float ldiff = totalLength + 0.5f * oneOverAccel * (sq(f_s) + sq(f_e));
 
   float T2 = ldiff / F_n - oneOverAccel * F_n;
@@ -603,14 +725,41 @@ void FTMotion::makeVector() {
     #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
     LOGICAL_AXIS_MAP_LC(_SET_TRAJ);
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      if (arc_sweep_per_mm) {
+        // Rotate the start vector about the center by the sweep so far
+        const float phi = arc_sweep_per_mm * dist, cos_p = cos(phi) - 1.0f, sin_p = sin(phi);
+        traj.x[makeVector_batchIdx] = startPosn.x + arc_rvec.x * cos_p - arc_rvec.y * sin_p;
+        traj.y[makeVector_batchIdx] = startPosn.y + arc_rvec.x * sin_p + arc_rvec.y * cos_p;
+      }
+    #endif
+
+    #if ENABLED(FTM_STEPPER_CHANNELS)
+      for (uint8_t c = 0; c < FTM_CHANNELS; ++c)
+        chTraj[c][makeVector_batchIdx] = chStartPosn[c] + chRatio[c] * dist;
+    #endif
+
     #if HAS_EXTRUDERS
       if (cfg.linearAdvEna) {
         float dedt_adj = (traj.e[makeVector_batchIdx] - e_raw_z1) * (FTM_FS);
-        if (ratio.e > 0.0f) dedt_adj += accel_k * cfg.linearAdvK * 0.0001f;
+        if (ratio.e > 0.0f) dedt_adj += accel_k * TERN(SYRINGE_FLOW_MODEL, e_advance_gain, cfg.linearAdvK * 0.0001f);
 
         e_raw_z1 = traj.e[makeVector_batchIdx];
         e_advanced_z1 += dedt_adj * (FTM_TS);
         traj.e[makeVector_batchIdx] = e_advanced_z1;
+
+        #if ENABLED(FTM_STEPPER_CHANNELS)
+          // Advance each syringe with its own gain
+          for (uint8_t e = 0; e < FTM_E_CHANNELS; ++e) {
+            float &ce = chTraj[FTM_Z_CHANNELS + e][makeVector_batchIdx];
+            float ch_dedt_adj = (ce - ch_e_raw_z1[e]) * (FTM_FS);
+            if (chRatio[FTM_Z_CHANNELS + e] > 0.0f) ch_dedt_adj += accel_k * ch_e_advance_gain[e];
+
+            ch_e_raw_z1[e] = ce;
+            ch_e_advanced_z1[e] += ch_dedt_adj * (FTM_TS);
+            ce = ch_e_advanced_z1[e];
+          }
+        #endif
       }
     #endif
 
@@ -698,6 +847,9 @@ void FTMotion::makeVector() {
  * - Two functions are used for command computation with an array of function pointers.
  */
 static void (*command_set[LOGICAL_AXES])(int32_t&, int32_t&, ft_command_t&, int32_t, int32_t);
+#if ENABLED(FTM_STEPPER_CHANNELS)
+  static void (*ch_command_set[FTM_CHANNELS])(int32_t&, int32_t&, ft_command_t&, int32_t, int32_t);
+#endif
 
 static void command_set_pos(int32_t &e, int32_t &s, ft_command_t &b, int32_t bd, int32_t bs) {
   if (e < FTM_CTS_COMPARE_VAL) return;
@@ -740,6 +892,16 @@ void FTMotion::convertToSteps(const uint32_t idx) {
   #define _COMMAND_SET(AXIS) command_set[_AXIS(AXIS)] = delta[_AXIS(AXIS)] >= 0 ? command_set_pos : command_set_neg;
   LOGICAL_AXIS_MAP(_COMMAND_SET);
 
+  #if ENABLED(FTM_STEPPER_CHANNELS)
+    // MarlinBio: Interpolate each Z and E stepper from its own channel
+    int32_t ch_delta[FTM_CHANNELS], ch_err_P[FTM_CHANNELS] = { 0 };
+    for (uint8_t c = 0; c < FTM_CHANNELS; ++c) {
+      const float spm = planner.settings.axis_steps_per_mm[c < FTM_Z_CHANNELS ? Z_AXIS : E_AXIS_N(c - FTM_Z_CHANNELS)];
+      ch_delta[c] = int32_t(chTrajMod[c][idx] * spm) - chSteps[c];
+      ch_command_set[c] = ch_delta[c] >= 0 ? command_set_pos : command_set_neg;
+    }
+  #endif
+
   for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
 
     ft_command_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
@@ -754,6 +916,13 @@ void FTMotion::convertToSteps(const uint32_t idx) {
     #define _COMMAND_RUN(A) command_set[_AXIS(A)](err_P.A, steps.A, cmd, _BV(FT_BIT_DIR_##A), _BV(FT_BIT_STEP_##A));
     LOGICAL_AXIS_MAP(_COMMAND_RUN);
 
+    #if ENABLED(FTM_STEPPER_CHANNELS)
+      for (uint8_t c = 0; c < FTM_CHANNELS; ++c) {
+        ch_err_P[c] += ch_delta[c];
+        ch_command_set[c](ch_err_P[c], chSteps[c], cmd, _BV32(FT_BIT_DIR_CH(c)), _BV32(FT_BIT_STEP_CH(c)));
+      }
+    #endif
+
     // Next circular buffer index
     if (++stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE))
       stepperCmdBuff_produceIdx = 0;
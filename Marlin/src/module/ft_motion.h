@@ -148,6 +148,10 @@ class FTMotion {
     static xyze_pos_t   startPosn,          // (mm) Start position of block
                         endPosn_prevBlock;  // (mm) End position of previous block
     static xyze_float_t ratio;              // (ratio) Axis move ratio of block
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      static float arc_sweep_per_mm;        // (rad/mm) Sweep of a curved block per mm of travel
+      static xy_float_t arc_rvec;           // (mm) Vector from the arc center to the start of the block
+    #endif
     static float accel_P, decel_P,
                  F_P,
                  f_s,
@@ -169,6 +173,19 @@ class FTMotion {
 
     static xyze_long_t steps;
 
+    #if ENABLED(FTM_STEPPER_CHANNELS)
+      // MarlinBio: Per-stepper channels for Z1-Z4 and E0-E3
+      static float chTraj[FTM_CHANNELS][FTM_WINDOW_SIZE],     // (mm) Trajectory of each stepper
+                   chTrajMod[FTM_CHANNELS][FTM_BATCH_SIZE],   // (mm) Trajectory window of each stepper
+                   chStartPosn[FTM_CHANNELS],                 // (mm) Start position of block
+                   chEndPosn_prevBlock[FTM_CHANNELS],         // (mm) End position of previous block
+                   chRatio[FTM_CHANNELS];                     // (ratio) Stepper move ratio of block
+      static int32_t chSteps[FTM_CHANNELS];                   // Step count accumulators
+
+      static bool z_channel_moves(const uint8_t c);
+      static bool e_channel_moves(const uint8_t c, const uint8_t extruder);
+    #endif
+
     // Shaping variables.
     #if HAS_FTM_SHAPING
 
@@ -201,6 +218,12 @@ class FTMotion {
     // Linear advance variables.
     #if HAS_EXTRUDERS
       static float e_raw_z1, e_advanced_z1;
+      #if ENABLED(SYRINGE_FLOW_MODEL)
+        static float e_advance_gain;
+      #endif
+      #if ENABLED(FTM_STEPPER_CHANNELS)
+        static float ch_e_raw_z1[FTM_E_CHANNELS], ch_e_advanced_z1[FTM_E_CHANNELS], ch_e_advance_gain[FTM_E_CHANNELS];
+      #endif
     #endif
 
     // Private methods
@@ -55,9 +55,13 @@ enum {
     FT_BIT_DIR_I, FT_BIT_STEP_I, FT_BIT_DIR_J, FT_BIT_STEP_J, FT_BIT_DIR_K, FT_BIT_STEP_K,
     FT_BIT_DIR_U, FT_BIT_STEP_U, FT_BIT_DIR_V, FT_BIT_STEP_V, FT_BIT_DIR_W, FT_BIT_STEP_W
   ),
-  FT_BIT_COUNT
+  FT_BIT_CHANNELS,  // MarlinBio: STEP / DIR pairs of the per-stepper channels follow the axes
+  FT_BIT_COUNT = FT_BIT_CHANNELS + 2 * (FTM_CHANNELS)
 };
 
+#define FT_BIT_DIR_CH(C)  (FT_BIT_CHANNELS + 2 * (C))
+#define FT_BIT_STEP_CH(C) (FT_BIT_CHANNELS + 2 * (C) + 1)
+
 #if HAS_FTM_SHAPING
   #define NUM_AXES_SHAPED TERN(HAS_Y_AXIS, 2, 1)
   #define SHAPED_ELEM(A, B) A OPTARG(HAS_Y_AXIS, B)
@@ -81,3 +85,11 @@ typedef FTShapedAxes<ftMotionShaper_t> ft_shaped_shaper_t;
 typedef FTShapedAxes<dynFreqMode_t>    ft_shaped_dfm_t;
 
 typedef bits_t(FT_BIT_COUNT) ft_command_t;
+
+#if ENABLED(FTM_STEPPER_CHANNELS)
+  // The STEP bits of the first C channels, leaving out their DIR bits
+  constexpr ft_command_t ft_step_ch_bits(const uint8_t c) {
+    return c ? (ft_command_t(1) << FT_BIT_STEP_CH(c - 1)) | ft_step_ch_bits(c - 1) : 0;
+  }
+  #define FT_STEP_CH_BITS ft_step_ch_bits(FTM_CHANNELS)
+#endif
@@ -77,6 +77,10 @@
   #include "../feature/bedlevel/bdl/bdl.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "coalescer.h"
+#endif
+
 // Relative Mode. Enable with G91, disable with G90.
 bool relative_mode; // = false
 
@@ -257,6 +261,7 @@ void report_current_position() {
  * definitively interrupts the printing flow.
  */
 void report_current_position_projected() {
+  SERIAL_REPORT_SCOPE();
   report_logical_position(current_position);
   stepper.report_a_position(planner.position);
 }
@@ -1751,7 +1756,11 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
       }
     #endif // HAS_MESH
 
-    planner.buffer_line(destination, scaled_fr_mm_s);
+    #if ENABLED(SEGMENT_COALESCING)
+      coalescer.line_to(destination, scaled_fr_mm_s);
+    #else
+      planner.buffer_line(destination, scaled_fr_mm_s);
+    #endif
     return false; // caller will update current_position
   }
 
@@ -2613,104 +2622,35 @@ void prepare_line_to_destination() {
         }
       #endif
 
-      // MarlinBio: This section handles homing offsets of the extra Z axes from the primary Z axis.
-      // It won't work without changes, and there's no need to make them until we have a convincing use case.
-      #if 0 // ENABLED(Z_MULTI_ENDSTOPS)
+      // MarlinBio: Apply the homing offsets of the extra Z axes from the primary Z axis.
+      // Every motor backs away from its own endstop by its own distance in a single move,
+      // so the whole set of syringes takes only as long as the largest adjustment.
+      #if ENABLED(Z_MULTI_ENDSTOPS)
         if (axis == Z_AXIS) {
-
-          #if NUM_Z_STEPPERS == 2
-
-            const float adj = ABS(endstops.z2_endstop_adj);
-            if (adj) {
-              if (pos_dir ? (endstops.z2_endstop_adj > 0) : (endstops.z2_endstop_adj < 0)) stepper.set_z1_lock(true); else stepper.set_z2_lock(true);
-              do_homing_move(axis, pos_dir ? -adj : adj);
-              stepper.set_z1_lock(false);
-              stepper.set_z2_lock(false);
-            }
-
-          #else
-
-            // Handy arrays of stepper lock function pointers
-
-            typedef void (*adjustFunc_t)(const bool);
-
-            adjustFunc_t lock[] = {
-              stepper.set_z1_lock, stepper.set_z2_lock, stepper.set_z3_lock
-              #if NUM_Z_STEPPERS >= 4
-                , stepper.set_z4_lock
-              #endif
-            };
-            float adj[] = {
-              0, endstops.z2_endstop_adj, endstops.z3_endstop_adj
+          const float adj[NUM_Z_STEPPERS] = {
+            0, endstops.z2_endstop_adj
+            #if NUM_Z_STEPPERS >= 3
+              , endstops.z3_endstop_adj
               #if NUM_Z_STEPPERS >= 4
                 , endstops.z4_endstop_adj
               #endif
-            };
-
-            adjustFunc_t tempLock;
-            float tempAdj;
-
-            // Manual bubble sort by adjust value
-            if (adj[1] < adj[0]) {
-              tempLock = lock[0], tempAdj = adj[0];
-              lock[0] = lock[1], adj[0] = adj[1];
-              lock[1] = tempLock, adj[1] = tempAdj;
-            }
-            if (adj[2] < adj[1]) {
-              tempLock = lock[1], tempAdj = adj[1];
-              lock[1] = lock[2], adj[1] = adj[2];
-              lock[2] = tempLock, adj[2] = tempAdj;
-            }
-            #if NUM_Z_STEPPERS >= 4
-              if (adj[3] < adj[2]) {
-                tempLock = lock[2], tempAdj = adj[2];
-                lock[2] = lock[3], adj[2] = adj[3];
-                lock[3] = tempLock, adj[3] = tempAdj;
-              }
-              if (adj[2] < adj[1]) {
-                tempLock = lock[1], tempAdj = adj[1];
-                lock[1] = lock[2], adj[1] = adj[2];
-                lock[2] = tempLock, adj[2] = tempAdj;
-              }
             #endif
-            if (adj[1] < adj[0]) {
-              tempLock = lock[0], tempAdj = adj[0];
-              lock[0] = lock[1], adj[0] = adj[1];
-              lock[1] = tempLock, adj[1] = tempAdj;
-            }
+          };
 
-            if (pos_dir) {
-              // normalize adj to smallest value and do the first move
-              (*lock[0])(true);
-              do_homing_move(axis, adj[1] - adj[0]);
-              // lock the second stepper for the final correction
-              (*lock[1])(true);
-              do_homing_move(axis, adj[2] - adj[1]);
-              #if NUM_Z_STEPPERS >= 4
-                // lock the third stepper for the final correction
-                (*lock[2])(true);
-                do_homing_move(axis, adj[3] - adj[2]);
-              #endif
-            }
-            else {
-              #if NUM_Z_STEPPERS >= 4
-                (*lock[3])(true);
-                do_homing_move(axis, adj[2] - adj[3]);
-              #endif
-              (*lock[2])(true);
-              do_homing_move(axis, adj[1] - adj[2]);
-              (*lock[1])(true);
-              do_homing_move(axis, adj[0] - adj[1]);
-            }
+          // The motor nearest the endstop side stays put, the others move away by their difference
+          float adj_min = adj[0], adj_max = adj[0];
+          for (uint8_t i = 1; i < NUM_Z_STEPPERS; ++i) { NOMORE(adj_min, adj[i]); NOLESS(adj_max, adj[i]); }
 
-            stepper.set_z1_lock(false);
-            stepper.set_z2_lock(false);
-            stepper.set_z3_lock(false);
-            #if NUM_Z_STEPPERS >= 4
-              stepper.set_z4_lock(false);
-            #endif
+          if (adj_max > adj_min) {
+            int32_t steps[NUM_Z_STEPPERS];
+            for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i)
+              steps[i] = LROUND((pos_dir ? adj[i] - adj_min : adj_max - adj[i]) * planner.settings.axis_steps_per_mm[Z_AXIS]);
 
-          #endif
+            if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Z multi-endstop adjust: ", adj_max - adj_min, "mm");
+            stepper.set_z_separate_steps(steps);
+            do_homing_move(axis, pos_dir ? adj_min - adj_max : adj_max - adj_min);
+            stepper.clear_z_separate_steps();
+          }
         }
       #endif
 
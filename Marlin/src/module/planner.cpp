@@ -72,6 +72,10 @@
 #if ENABLED(FT_MOTION)
   #include "ft_motion.h"
 #endif
+
+#if ENABLED(SEGMENT_COALESCING)
+  #include "coalescer.h"
+#endif
 #include "../lcd/marlinui.h"
 #include "../gcode/parser.h"
 
@@ -93,6 +97,10 @@
   #include "../feature/mixing.h"
 #endif
 
+#if ENABLED(PLANNER_FIXED_POINT)
+  #include "planner_fixed.h"
+#endif
+
 #if ENABLED(AUTO_POWER_CONTROL)
   #include "../feature/power.h"
 #endif
@@ -113,6 +121,18 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(UV_EXPOSURE_HEAD)
+  #include "../feature/uv_exposure.h"
+#endif
+
+#if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+  #include "../feature/camera_capture.h"
+#endif
+
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #include "../feature/syringe_flow.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_NONE         0U
@@ -125,10 +145,36 @@ Planner planner;
 /**
  * A ring buffer of moves described in steps
  */
-block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
-volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
-                 Planner::block_buffer_nonbusy, // Index of the first non-busy block
-                 Planner::block_buffer_tail;    // Index of the busy block, if any
+#if ENABLED(RUNTIME_BLOCK_BUFFER)
+  block_t Planner::block_buffer[block_pool_size];
+  block_index_t Planner::block_buffer_size = block_pool_size,       // Blocks in the live ring
+                Planner::block_buffer_mask = block_pool_size - 1;   // Ring index mask
+#else
+  block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
+#endif
+#if ENABLED(COMPACT_PLANNER_BLOCKS)
+  block_plan_t Planner::block_plan[TERN(RUNTIME_BLOCK_BUFFER, block_pool_size, BLOCK_BUFFER_SIZE)]; // Planner-only part of each block
+#endif
+volatile block_index_t Planner::block_buffer_head,    // Index of the next block to be pushed
+                       Planner::block_buffer_nonbusy, // Index of the first non-busy block
+                       Planner::block_buffer_tail;    // Index of the busy block, if any
+#if ENABLED(INCREMENTAL_LOOKAHEAD)
+  block_index_t Planner::block_buffer_planned;        // Newest block whose entry speed can no longer change
+#endif
+#if ENABLED(PLANNER_LOOKAHEAD_STATS)
+  Planner::lookahead_stats_t Planner::lookahead_stats; // Blocks visited by recalculate()
+#endif
+#if ENABLED(COMPACT_PLANNER_BLOCKS)
+  block_state_t Planner::tail_state,              // State applied by the last sync_state record to run
+                Planner::queued_state;            // State carried by the last sync_state record queued
+  bool Planner::queued_state_valid,               // Cleared when queued records are dropped
+       Planner::block_state_changed;              // Set when fans, etc. change. Cleared by the next move.
+#endif
+#if ENABLED(OUTPUT_EVENT_BLOCKS)
+  output_event_t Planner::sync_output,            // Payload for the next sync_output block
+                 Planner::pending_output;         // Pin change waiting for travel
+  float Planner::pending_output_mm;               // Travel left before pending_output applies
+#endif
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
@@ -742,7 +788,7 @@ void Planner::init() {
  */
 block_t* Planner::get_current_block() {
   // Get the number of moves in the planner queue so far
-  const uint8_t nr_moves = movesplanned();
+  const block_index_t nr_moves = movesplanned();
 
   // If there are any moves queued ...
   if (nr_moves) {
@@ -778,14 +824,33 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
-block_t* Planner::get_future_block(const uint8_t offset) {
-  const uint8_t nr_moves = movesplanned();
+block_t* Planner::get_future_block(const block_index_t offset) {
+  const block_index_t nr_moves = movesplanned();
   if (nr_moves <= offset) return nullptr;
   block_t * const block = &block_buffer[block_inc_mod(block_buffer_tail, offset)];
   if (block->flag.recalculate) return nullptr;
   return block;
 }
 
+#if ENABLED(RUNTIME_BLOCK_BUFFER)
+
+  bool Planner::set_block_buffer_size(const block_index_t blocks) {
+    if (!IS_POWER_OF_2(blocks) || !WITHIN(blocks, BLOCK_BUFFER_SIZE, block_pool_size)) return false;
+    if (blocks == block_buffer_size) return true;
+
+    synchronize(); // Let queued moves finish, e.g., M501 during a print
+
+    // Indices are re-based to 0 so they stay inside the new mask
+    const bool was_enabled = stepper.suspend();
+    clear_block_buffer();
+    block_buffer_size = blocks;
+    block_buffer_mask = blocks - 1;
+    if (was_enabled) stepper.wake_up();
+    return true;
+  }
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors. If entry_factor is 0 don't change the initial_rate.
@@ -801,7 +866,8 @@ block_t* Planner::get_future_block(const uint8_t offset) {
  */
 void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_speed, const_float_t exit_speed) {
 
-  const float spmm = block->steps_per_mm;
+  const block_plan_t &plan = plan_of(block);
+  const float spmm = plan.steps_per_mm;
   uint32_t initial_rate = entry_speed ? LROUND(entry_speed * spmm) : block->initial_rate,
            final_rate = LROUND(exit_speed * spmm);
 
@@ -819,44 +885,77 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
           accelerate_steps = 0,
           decelerate_steps = 0;
 
-  const int32_t accel = block->acceleration_steps_per_s2;
-  float inverse_accel = 0.0f;
-  if (accel != 0) {
-    inverse_accel = 1.0f / accel;
-    const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = FLOAT_SQ(block->nominal_rate),
-                // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(final_rate)),
-                accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(initial_rate));
-    // Aims to fully reach nominal and final rates
-    accelerate_steps = CEIL(accelerate_steps_float);
-    decelerate_steps = CEIL(decelerate_steps_float);
-
-    // Steps between acceleration and deceleration, if any
-    plateau_steps -= accelerate_steps + decelerate_steps;
-
-    // Does accelerate_steps + decelerate_steps exceed step_event_count?
-    // Then we can't possibly reach the nominal rate, there will be no cruising.
-    // Calculate accel / braking time in order to reach the final_rate exactly
-    // at the end of this block.
-    if (plateau_steps < 0) {
-      accelerate_steps = LROUND((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
-      LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
-      decelerate_steps = block->step_event_count - accelerate_steps;
-
-      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
-        // We won't reach the cruising rate. Let's calculate the speed we will reach
-        NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
-      #endif
+  const int32_t accel = plan.acceleration_steps_per_s2;
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+
+    if (accel != 0) {
+      // Steps required for acceleration, deceleration to/from nominal rate
+      accelerate_steps = TrapezoidFixed::ramp_steps(initial_rate, block->nominal_rate, accel);
+      decelerate_steps = TrapezoidFixed::ramp_steps(final_rate, block->nominal_rate, accel);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // No cruising. Find the step where acceleration turns into deceleration.
+      if (plateau_steps < 0) {
+        accelerate_steps = TrapezoidFixed::intersection_steps(initial_rate, final_rate, accel, block->step_event_count);
+        LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          NOMORE(cruise_rate, TrapezoidFixed::reached_rate(initial_rate, accel, accelerate_steps));
+        #endif
+      }
     }
-  }
 
-  #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
-    const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
-    // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
-             deceleration_time = rate_factor * float(cruise_rate - final_rate);
-  #endif
+    #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
+      uint32_t acceleration_time = TrapezoidFixed::ramp_ticks(initial_rate, cruise_rate, accel, STEPPER_TIMER_RATE),
+               deceleration_time = TrapezoidFixed::ramp_ticks(final_rate, cruise_rate, accel, STEPPER_TIMER_RATE);
+    #endif
+
+  #else // !PLANNER_FIXED_POINT
+
+    float inverse_accel = 0.0f;
+    if (accel != 0) {
+      inverse_accel = 1.0f / accel;
+      const float half_inverse_accel = 0.5f * inverse_accel,
+                  nominal_rate_sq = FLOAT_SQ(block->nominal_rate),
+                  // Steps required for acceleration, deceleration to/from nominal rate
+                  decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(final_rate)),
+                  accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(initial_rate));
+      // Aims to fully reach nominal and final rates
+      accelerate_steps = CEIL(accelerate_steps_float);
+      decelerate_steps = CEIL(decelerate_steps_float);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // Does accelerate_steps + decelerate_steps exceed step_event_count?
+      // Then we can't possibly reach the nominal rate, there will be no cruising.
+      // Calculate accel / braking time in order to reach the final_rate exactly
+      // at the end of this block.
+      if (plateau_steps < 0) {
+        accelerate_steps = LROUND((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+        LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
+        #endif
+      }
+    }
+
+    #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
+      const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
+               deceleration_time = rate_factor * float(cruise_rate - final_rate);
+    #endif
+
+  #endif // !PLANNER_FIXED_POINT
+
   #if ENABLED(S_CURVE_ACCELERATION)
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
     uint32_t acceleration_time_inverse = get_period_inverse(acceleration_time),
@@ -879,7 +978,9 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
     block->deceleration_time_inverse = deceleration_time_inverse;
   #endif
   #if ENABLED(SMOOTH_LIN_ADVANCE)
-    block->cruise_time = plateau_steps > 0 ? float(plateau_steps) * float(STEPPER_TIMER_RATE) / float(cruise_rate) : 0;
+    block->cruise_time = plateau_steps <= 0 ? 0
+      : TERN(PLANNER_FIXED_POINT, TrapezoidFixed::cruise_ticks(plateau_steps, cruise_rate, STEPPER_TIMER_RATE),
+                                  float(plateau_steps) * float(STEPPER_TIMER_RATE) / float(cruise_rate));
   #endif
 
   #if HAS_ROUGH_LIN_ADVANCE
@@ -887,6 +988,8 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
       const float comp = extruder_advance_K[E_INDEX_N(block->extruder)] * block->steps.e / block->step_event_count;
       block->max_adv_steps = cruise_rate * comp;
       block->final_adv_steps = final_rate * comp;
+      // MarlinBio: The stepper holds the syringe pressure at this many advance steps per step event rate
+      TERN_(SYRINGE_CONSTANT_VOLUME, block->la_adv_comp = comp * 65536.0f);
     }
   #endif
 
@@ -1009,12 +1112,13 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
 bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const next, const_float_t safe_exit_speed_sqr) {
   // We need to recalculate only for the last block added or if next->entry_speed_sqr changed.
   if (!next || next->flag.recalculate) {
+    block_plan_t &cur = plan_of(current);
     // And only if we're not already at max entry speed.
-    if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
-      const float next_entry_speed_sqr = next ? next->entry_speed_sqr : safe_exit_speed_sqr;
-      float new_entry_speed_sqr = max_allowable_speed_sqr(-current->acceleration, next_entry_speed_sqr, current->millimeters);
-      NOMORE(new_entry_speed_sqr, current->max_entry_speed_sqr);
-      if (current->entry_speed_sqr != new_entry_speed_sqr) {
+    if (cur.entry_speed_sqr != cur.max_entry_speed_sqr) {
+      const float next_entry_speed_sqr = next ? plan_of(next).entry_speed_sqr : safe_exit_speed_sqr;
+      float new_entry_speed_sqr = max_allowable_speed_sqr(-cur.acceleration, next_entry_speed_sqr, cur.millimeters);
+      NOMORE(new_entry_speed_sqr, cur.max_entry_speed_sqr);
+      if (cur.entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
         // ISR does not consume the block before being recalculated
@@ -1030,7 +1134,7 @@ bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const
         else {
           // Block is not BUSY so this is ahead of the Stepper ISR:
 
-          current->entry_speed_sqr = new_entry_speed_sqr;
+          cur.entry_speed_sqr = new_entry_speed_sqr;
           return true;
         }
       }
@@ -1044,24 +1148,37 @@ bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const
  * Once in reverse and once forward. This implements the reverse pass that
  * coarsely maximizes the entry speeds starting from last block.
  * Requires there's at least one block with flag.recalculate in the buffer.
+ *
+ * Return the index where the forward pass should start. With INCREMENTAL_LOOKAHEAD
+ * this is the move where the reverse pass stopped, since the moves before it
+ * didn't change. Otherwise it is the tail.
  */
-void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
+block_index_t Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
   // Initialize block index to the last block in the planner buffer.
   // This last block will have flag.recalculate set.
-  uint8_t block_index = prev_block_index(block_buffer_head);
+  block_index_t block_index = prev_block_index(block_buffer_head);
 
   // The ISR may change block_buffer_nonbusy so get a stable local copy.
-  uint8_t nonbusy_block_index = block_buffer_nonbusy;
+  block_index_t nonbusy_block_index = block_buffer_nonbusy;
+
+  #if ENABLED(INCREMENTAL_LOOKAHEAD)
+    // Entry speeds up to the frontier are final. Ignore a frontier the ISR has already reached.
+    block_index_t planned_block_index = block_buffer_planned;
+    if (block_dec_mod(planned_block_index, nonbusy_block_index) >= block_dec_mod(block_buffer_head, nonbusy_block_index))
+      planned_block_index = nonbusy_block_index;
+  #endif
 
   const block_t *next = nullptr;
-  // Don't try to change the entry speed of the first non-busy block.
-  while (block_index != nonbusy_block_index) {
+  // Don't try to change the entry speed of the first non-busy block (or the frontier block).
+  while (block_index != nonbusy_block_index && TERN1(INCREMENTAL_LOOKAHEAD, block_index != planned_block_index)) {
     block_t *current = &block_buffer[block_index];
 
+    TERN_(PLANNER_LOOKAHEAD_STATS, lookahead_stats.last++);
+
     // Only process movement blocks
     if (current->is_move()) {
       // If no entry speed increase was possible we end the reverse pass.
-      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return;
+      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return TERN(INCREMENTAL_LOOKAHEAD, block_index, block_buffer_tail);
       next = current;
     }
 
@@ -1073,59 +1190,91 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
     while (nonbusy_block_index != block_buffer_nonbusy) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == nonbusy_block_index) return;
+      if (block_index == nonbusy_block_index) return block_buffer_tail;
 
       // Advance the pointer, following the busy block
       nonbusy_block_index = next_block_index(nonbusy_block_index);
     }
   }
+
+  // Stopped at the frontier? The forward pass can start there.
+  return TERN0(INCREMENTAL_LOOKAHEAD, block_index != nonbusy_block_index) ? block_index : block_buffer_tail;
 }
 
 // The kernel called during the forward pass. Assumes current->flag.recalculate.
 void Planner::forward_pass_kernel(const block_t * const previous, block_t * const current) {
+  const block_plan_t &prev = plan_of(previous);
+  block_plan_t &cur = plan_of(current);
+
   // Check if the previous block is accelerating.
-  if (previous->entry_speed_sqr < current->entry_speed_sqr) {
+  if (prev.entry_speed_sqr < cur.entry_speed_sqr) {
     // Compute the maximum achievable speed if the previous block was fully accelerating.
-    float new_exit_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+    float new_exit_speed_sqr = max_allowable_speed_sqr(-prev.acceleration, prev.entry_speed_sqr, prev.millimeters);
 
-    if (new_exit_speed_sqr < current->entry_speed_sqr) {
+    if (new_exit_speed_sqr < cur.entry_speed_sqr) {
       // Current entry speed limited by full acceleration from previous entry speed.
 
       // Make sure entry speed not lower than minimum_planner_speed_sqr.
-      NOLESS(new_exit_speed_sqr, current->min_entry_speed_sqr);
-      current->entry_speed_sqr = new_exit_speed_sqr;
+      NOLESS(new_exit_speed_sqr, cur.min_entry_speed_sqr);
+      cur.entry_speed_sqr = new_exit_speed_sqr;
       // Ensure we don't try updating entry_speed_sqr again.
-      current->max_entry_speed_sqr = new_exit_speed_sqr;
+      cur.max_entry_speed_sqr = new_exit_speed_sqr;
     }
   }
 
   // The fully optimized entry speed is our new minimum speed.
-  current->min_entry_speed_sqr = current->entry_speed_sqr;
+  cur.min_entry_speed_sqr = cur.entry_speed_sqr;
 }
 
 /**
  * Do the forward pass and recalculate the trapezoid speed profiles for all blocks in the plan
  * according to entry/exit speeds.
  */
-void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
-  // Start with the block that's about to execute or is executing.
-  uint8_t block_index = block_buffer_tail,
-          head_block_index = block_buffer_head;
+void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr, const block_index_t start_index) {
+  // Start with the block that's about to execute or is executing,
+  // or with the last unchanged move before the recalculated ones.
+  block_index_t block_index = start_index,
+                head_block_index = block_buffer_head;
+
+  #if ENABLED(INCREMENTAL_LOOKAHEAD)
+    // Fall back to the tail if the ISR has already consumed the start block
+    const block_index_t tail_block_index = block_buffer_tail;
+    if (block_dec_mod(block_index, tail_block_index) >= block_dec_mod(head_block_index, tail_block_index))
+      block_index = tail_block_index;
+  #endif
 
   block_t *block = nullptr, *next = nullptr;
   float next_entry_speed = 0.0f;
+
+  #if ENABLED(INCREMENTAL_LOOKAHEAD)
+    // Starting after the tail, the start block keeps its entry speed but the moves after it may
+    // have changed. Lead with it as the block before them, so its exit and trapezoid are redone.
+    if (block_index != tail_block_index) {
+      block_t * const start = &block_buffer[block_index];
+      if (start->is_move() && TERN1(E_ONLY_FAST_PATH, ANY_AXIS_MOVES(start))) {
+        TERN_(PLANNER_LOOKAHEAD_STATS, lookahead_stats.last++);
+        block = start;
+        next_entry_speed = SQRT(plan_of(start).entry_speed_sqr);
+        block_index = next_block_index(block_index);
+      }
+    }
+  #endif
+
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
+    TERN_(PLANNER_LOOKAHEAD_STATS, lookahead_stats.last++);
+
     if (next->is_move()) {
       // Check if the next block's entry speed changed
       if (next->flag.recalculate) {
+        block_plan_t &next_plan = plan_of(next);
         if (!block) {
           // 'next' is the first move due to either being the first added move or due to the planner
           // having completely fallen behind. Revert any reverse pass change.
-          next->entry_speed_sqr = next->min_entry_speed_sqr;
-          next_entry_speed = SQRT(next->min_entry_speed_sqr);
+          next_plan.entry_speed_sqr = next_plan.min_entry_speed_sqr;
+          next_entry_speed = SQRT(next_plan.min_entry_speed_sqr);
         }
         else {
           // Try to fix exit speed which requires trapezoid recalculation
@@ -1135,7 +1284,7 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
           // become BUSY just before being marked RECALCULATE, so check for that!
           if (stepper.is_block_busy(block)) {
             // Block is BUSY so we can't change the exit speed. Revert any reverse pass change.
-            next->entry_speed_sqr = next->min_entry_speed_sqr;
+            next_plan.entry_speed_sqr = next_plan.min_entry_speed_sqr;
             if (!next->initial_rate) {
               // 'next' was never calculated. Planner is falling behind so for maximum efficiency
               // set next's stepping speed directly and forgo checking against min_entry_speed_sqr.
@@ -1147,11 +1296,19 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
           else {
             // Block is not BUSY: we won the race against the ISR or recalculate was already set
 
-            if (next->entry_speed_sqr != next->min_entry_speed_sqr)
+            if (next_plan.entry_speed_sqr != next_plan.min_entry_speed_sqr)
               forward_pass_kernel(block, next);
 
+            // An entry speed at its maximum can't change again. Advance the frontier.
+            #if ENABLED(INCREMENTAL_LOOKAHEAD)
+              if (next_plan.entry_speed_sqr == next_plan.max_entry_speed_sqr) block_buffer_planned = block_index;
+            #endif
+
             const float current_entry_speed = next_entry_speed;
-            next_entry_speed = SQRT(next->entry_speed_sqr);
+            next_entry_speed = SQRT(next_plan.entry_speed_sqr);
+
+            // MarlinBio: Pressure that isn't carried into an advanced block would ooze during the next move
+            TERN_(SYRINGE_CONSTANT_VOLUME, block->flag.pressure_release = !next->la_advance_rate);
 
             calculate_trapezoid_for_block(block, current_entry_speed, next_entry_speed);
           }
@@ -1162,7 +1319,8 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
         }
       }
 
-      block = next;
+      // MarlinBio: The move after an E-only move is planned like a first move
+      block = TERN(E_ONLY_FAST_PATH, ANY_AXIS_MOVES(next) ? next : nullptr, next);
     }
 
     block_index = next_block_index(block_index);
@@ -1183,11 +1341,62 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
 
 // Requires there's at least one block with flag.recalculate in the buffer
 void Planner::recalculate(const_float_t safe_exit_speed_sqr) {
-  reverse_pass(safe_exit_speed_sqr);
+  TERN_(PLANNER_LOOKAHEAD_STATS, lookahead_stats.last = 0);
+  const block_index_t start_index = reverse_pass(safe_exit_speed_sqr);
   // The forward pass is done as part of recalculate_trapezoids()
-  recalculate_trapezoids(safe_exit_speed_sqr);
+  recalculate_trapezoids(safe_exit_speed_sqr, start_index);
+  TERN_(PLANNER_LOOKAHEAD_STATS, lookahead_stats.add());
+}
+
+/**
+ * Capture the fan speeds, mixer color, and paste pressures for a new block
+ */
+void Planner::populate_block_state(block_state_t &state) {
+  memset(&state, 0, sizeof(state)); // Padding too, for comparison with memcmp
+
+  TERN_(MIXING_EXTRUDER, mixer.populate_block(state.b_color));
+
+  #if HAS_FAN
+    FANS_LOOP(i) state.fan_speed[i] = thermalManager.fan_speed[i];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    state.valve_pressure = baricuda_valve_pressure;
+    state.e_to_p_pressure = baricuda_e_to_p_pressure;
+  #endif
 }
 
+#if ENABLED(COMPACT_PLANNER_BLOCKS)
+
+  /**
+   * Apply the state carried by a sync_state record. Fans and paste pressure are
+   * updated from tail_state by check_axes_activity(). The mixer is set up here.
+   *
+   * WARNING: Called from Stepper ISR context!
+   */
+  void Planner::apply_block_state(block_state_t &state) {
+    tail_state = state;
+    TERN_(MIXING_EXTRUDER, mixer.stepper_setup(state.b_color));
+  }
+
+  /**
+   * Queue a sync_state record if the fans, mixer, etc. differ
+   * from the state carried by the last record queued.
+   * Fans and paste pressure are only compared after a setter has flagged a change.
+   * The mixer color changes with vtools, gradients and the LCD, so it is always compared.
+   */
+  void Planner::buffer_state_change() {
+    if (queued_state_valid && !block_state_changed && DISABLED(MIXING_EXTRUDER)) return;
+    block_state_changed = false;
+
+    block_state_t state;
+    populate_block_state(state);
+    if (!queued_state_valid || memcmp(&state, &queued_state, sizeof(state)))
+      buffer_sync_block(BLOCK_BIT_SYNC_STATE);
+  }
+
+#endif
+
 /**
  * Apply fan speeds
  */
@@ -1257,15 +1466,16 @@ void Planner::check_axes_activity() {
     #endif
   #endif
 
-  if (has_blocks_queued()) {
+  if (has_buffered_blocks()) {
 
     #if ANY(HAS_TAIL_FAN_SPEED, BARICUDA)
-      block_t *block = &block_buffer[block_buffer_tail];
+      // The state of the running block, or of the last sync_state record run
+      const block_state_t &state = TERN(COMPACT_PLANNER_BLOCKS, tail_state, block_buffer[block_buffer_tail].state);
     #endif
 
     #if HAS_TAIL_FAN_SPEED
       FANS_LOOP(i) {
-        const uint8_t spd = thermalManager.scaledFanSpeed(i, block->fan_speed[i]);
+        const uint8_t spd = thermalManager.scaledFanSpeed(i, state.fan_speed[i]);
         if (tail_fan_speed[i] != spd) {
           fans_need_update = true;
           tail_fan_speed[i] = spd;
@@ -1274,12 +1484,12 @@ void Planner::check_axes_activity() {
     #endif
 
     #if ENABLED(BARICUDA)
-      TERN_(HAS_HEATER_1, tail_valve_pressure = block->valve_pressure);
-      TERN_(HAS_HEATER_2, tail_e_to_p_pressure = block->e_to_p_pressure);
+      TERN_(HAS_HEATER_1, tail_valve_pressure = state.valve_pressure);
+      TERN_(HAS_HEATER_2, tail_e_to_p_pressure = state.e_to_p_pressure);
     #endif
 
     #if HAS_DISABLE_AXES
-      for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+      for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
         block_t * const bnext = &block_buffer[b];
         LOGICAL_AXIS_CODE(
           if (TERN0(DISABLE_E, bnext->steps.e)) axis_active.e = true,
@@ -1397,10 +1607,10 @@ void Planner::check_axes_activity() {
     if (thermalManager.degTargetHotend(active_extruder) < autotemp.min - 2) return; // Below the min?
 
     float high = 0.0f;
-    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+    for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
       const block_t * const block = &block_buffer[b];
       if (NUM_AXIS_GANG(block->steps.x, || block->steps.y, || block->steps.z, || block->steps.i, || block->steps.j, || block->steps.k, || block->steps.u, || block->steps.v, || block->steps.w)) {
-        const float se = float(block->steps.e) / block->step_event_count * block->nominal_speed; // mm/sec
+        const float se = float(block->steps.e) / block->step_event_count * plan_of(block).nominal_speed; // mm/sec
         NOLESS(high, se);
       }
     }
@@ -1425,13 +1635,21 @@ void Planner::check_axes_activity() {
     return (parser.volumetric_enabled && diameter) ? 1.0f / CIRCLE_AREA(diameter * 0.5f) : 1;
   }
 
+  /**
+   * The diameter behind the volumetric multiplier of an extruder.
+   * A syringe barrel is used in place of the M200 filament size.
+   */
+  inline float volumetric_diameter(const uint8_t e) {
+    return TERN(SYRINGE_FLOW_MODEL, syringe_flow.volumetric_diameter(e, Planner::filament_size[e]), Planner::filament_size[e]);
+  }
+
   /**
    * Convert the filament sizes into volumetric multipliers.
    * The multiplier converts a given E value into a length.
    */
   void Planner::calculate_volumetric_multipliers() {
     for (uint8_t i = 0; i < COUNT(filament_size); ++i) {
-      volumetric_multiplier[i] = calculate_volumetric_multiplier(filament_size[i]);
+      volumetric_multiplier[i] = calculate_volumetric_multiplier(volumetric_diameter(i));
       refresh_e_factor(i);
     }
     #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
@@ -1447,7 +1665,7 @@ void Planner::check_axes_activity() {
    * Convert volumetric based limits into pre calculated extruder feedrate limits.
    */
   void Planner::calculate_volumetric_extruder_limit(const uint8_t e) {
-    const float &lim = volumetric_extruder_limit[e], &siz = filament_size[e];
+    const float &lim = volumetric_extruder_limit[e], siz = volumetric_diameter(e);
     volumetric_extruder_feedrate_limit[e] = (lim && siz) ? lim / CIRCLE_AREA(siz * 0.5f) : 0;
   }
   void Planner::calculate_volumetric_extruder_limits() {
@@ -1600,7 +1818,11 @@ void Planner::quick_stop() {
   const bool was_enabled = stepper.suspend();
 
   // Drop all queue entries
-  const uint8_t tail_value = block_buffer_tail; // Read tail value once
+  TERN_(SEGMENT_COALESCING, coalescer.discard());
+  TERN_(COMPACT_PLANNER_BLOCKS, queued_state_valid = false); // Dropped records may have changed the state
+  TERN_(TOOLCHANGE_SYNC_BLOCK, stepper.set_all_z_lock(true, active_extruder)); // A dropped tool change still applies
+  TERN_(OUTPUT_EVENT_BLOCKS, pending_output_mm = 0); // Its travel will never come
+  const block_index_t tail_value = block_buffer_tail; // Read tail value once
   block_buffer_head = tail_value;
   block_buffer_nonbusy = tail_value;
 
@@ -1658,6 +1880,7 @@ bool Planner::busy() {
 }
 
 void Planner::finish_and_disable() {
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
   while (has_blocks_queued() || cleaning_buffer_counter) idle();
   stepper.disable_all_steppers();
 }
@@ -1718,7 +1941,11 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+  TERN_(OUTPUT_EVENT_BLOCKS, flush_pending_output()); // No more travel will come
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -1738,8 +1965,14 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
 ) {
 
+  // A held move goes first
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+
+  // Fans, mixer, etc. may need a sync_state record ahead of the move
+  TERN_(COMPACT_PLANNER_BLOCKS, buffer_state_change());
+
   // Wait for the next available block
-  uint8_t next_buffer_head;
+  block_index_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
   // If we are cleaning, do not accept queuing of movements
@@ -1774,6 +2007,18 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
+  #if ENABLED(E_ONLY_FAST_PATH)
+    // An E-only move is its own trapezoid. The moves before it keep their plan,
+    // which already ends at a speed safe to stop from.
+    if (!ANY_AXIS_MOVES(block)) {
+      const float entry_speed = SQRT(plan_of(block).entry_speed_sqr);
+      calculate_trapezoid_for_block(block, entry_speed, entry_speed);
+      TERN_(INCREMENTAL_LOOKAHEAD, block_buffer_planned = prev_block_index(next_buffer_head));
+      block->flag.recalculate = false;
+      return true;
+    }
+  #endif
+
   // find a speed from which the new block can stop safely
   const float safe_exit_speed_sqr = _MAX(
     TERN0(HINTS_SAFE_EXIT_SPEED, hints.safe_exit_speed_sqr),
@@ -1811,6 +2056,7 @@ bool Planner::_populate_block(
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
   , float &minimum_planner_speed_sqr
 ) {
+  block_plan_t &plan = plan_of(block);
   xyze_long_t dist = target - position;
 
   /* <-- add a slash to enable
@@ -1941,6 +2187,12 @@ bool Planner::_populate_block(
   // Set direction bits
   block->direction_bits = dm;
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // MarlinBio: Curved XY path, interpolated by FT Motion
+    plan.arc_sweep = hints.arc_sweep;
+    plan.arc_rvec = hints.arc_rvec;
+  #endif
+
   /**
    * Update block laser power
    * For standard mode get the cutter.power value for processing, since it's
@@ -2059,11 +2311,12 @@ bool Planner::_populate_block(
       && block->steps.u < MIN_STEPS_PER_SEGMENT, && block->steps.v < MIN_STEPS_PER_SEGMENT, && block->steps.w < MIN_STEPS_PER_SEGMENT
     )
   ) {
-    block->millimeters = TERN0(HAS_EXTRUDERS, ABS(dist_mm.e));
+    plan.millimeters = TERN0(HAS_EXTRUDERS, ABS(dist_mm.e));
+    TERN_(ARC_NATIVE_BLOCKS, plan.arc_sweep = 0);
   }
   else {
     if (hints.millimeters)
-      block->millimeters = hints.millimeters;
+      plan.millimeters = hints.millimeters;
     else {
       const xyze_pos_t displacement = LOGICAL_AXIS_ARRAY(
         dist_mm.e,
@@ -2080,7 +2333,7 @@ bool Planner::_populate_block(
         dist_mm.u, dist_mm.v, dist_mm.w
       );
 
-      block->millimeters = get_move_distance(displacement OPTARG(HAS_ROTATIONAL_AXES, cartesian_move));
+      plan.millimeters = get_move_distance(displacement OPTARG(HAS_ROTATIONAL_AXES, cartesian_move));
     }
 
     /**
@@ -2112,15 +2365,9 @@ bool Planner::_populate_block(
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
-  TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color));
-
-  #if HAS_FAN
-    FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
-  #endif
-
-  #if ENABLED(BARICUDA)
-    block->valve_pressure = baricuda_valve_pressure;
-    block->e_to_p_pressure = baricuda_e_to_p_pressure;
+  // Fans, mixer, etc. (With COMPACT_PLANNER_BLOCKS a sync_state record was queued ahead if needed)
+  #if DISABLED(COMPACT_PLANNER_BLOCKS)
+    populate_block_state(block->state);
   #endif
 
   E_TERN_(block->extruder = extruder);
@@ -2195,7 +2442,7 @@ bool Planner::_populate_block(
         #define ENABLE_ONE_E(N) do{ \
           if (N == E_STEPPER_INDEX(extruder) || _IS_DUPE(N)) {  /* N is 'extruder', or N is duplicating */ \
             stepper.ENABLE_EXTRUDER(N);                         /* Enable the relevant E stepper... */ \
-            extruder_last_move[N] = (BLOCK_BUFFER_SIZE) * 2;    /* ...and reset its counter */ \
+            extruder_last_move[N] = (BLOCK_BUFFER_COUNT) * 2;   /* ...and reset its counter */ \
           } \
           else if (!extruder_last_move[N])                      /* Counter expired since last E stepper enable */ \
             stepper.DISABLE_EXTRUDER(N);                        /* Disable the E stepper */ \
@@ -2216,7 +2463,7 @@ bool Planner::_populate_block(
   else
     NOLESS(fr_mm_s, settings.min_travel_feedrate_mm_s);
 
-  const float inverse_millimeters = 1.0f / block->millimeters;  // Inverse millimeters to remove multiple divides
+  const float inverse_millimeters = 1.0f / plan.millimeters;  // Inverse millimeters to remove multiple divides
 
   /**
    * Calculate inverse time for this move. No divide by zero due to previous checks.
@@ -2236,7 +2483,7 @@ bool Planner::_populate_block(
   );
 
   // Get the number of non busy movements in queue (non busy means that they can be altered)
-  const uint8_t moves_queued = nonbusy_movesplanned();
+  const block_index_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
   #if ANY(SLOWDOWN, HAS_WIRED_LCD) || defined(XY_FREQUENCY_LIMIT)
@@ -2248,7 +2495,8 @@ bool Planner::_populate_block(
     #ifndef SLOWDOWN_DIVISOR
       #define SLOWDOWN_DIVISOR 2
     #endif
-    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)) {
+    // Compared with the live ring size, which RUNTIME_BLOCK_BUFFER may change
+    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_COUNT) / (SLOWDOWN_DIVISOR) - 1)) {
       #ifdef MAX7219_DEBUG_SLOWDOWN
         slowdown_count = (slowdown_count + 1) & 0x0F;
       #endif
@@ -2274,7 +2522,7 @@ bool Planner::_populate_block(
     if (was_enabled) stepper.wake_up();
   #endif
 
-  block->nominal_speed = block->millimeters * inverse_secs;           // (mm/sec) Always > 0
+  plan.nominal_speed = plan.millimeters * inverse_secs;               // (mm/sec) Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -2295,6 +2543,20 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    if (plan.arc_sweep) {
+      // Somewhere along a curve X and Y each reach the full XY speed,
+      // and the centripetal acceleration v^2/r is limited like a junction.
+      // The radius comes from the block itself. hints.curve_radius is only
+      // set from the second piece on, since it also sets the entry junction.
+      const float arc_radius = plan.arc_rvec.magnitude(),
+                  xy_speed = ABS(plan.arc_sweep) * arc_radius * inverse_secs,
+                  max_xy_fr = _MIN(settings.max_feedrate_mm_s[X_AXIS], settings.max_feedrate_mm_s[Y_AXIS]),
+                  max_xy_fr_sqr = _MIN(sq(max_xy_fr), (esteps ? settings.acceleration : settings.travel_acceleration) * arc_radius);
+      if (sq(xy_speed) > max_xy_fr_sqr) NOMORE(speed_factor, SQRT(max_xy_fr_sqr) / xy_speed);
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if HAS_EXTRUDERS
   {
@@ -2368,12 +2630,12 @@ bool Planner::_populate_block(
   if (speed_factor < 1.0f) {
     current_speed *= speed_factor;
     block->nominal_rate *= speed_factor;
-    block->nominal_speed *= speed_factor;
+    plan.nominal_speed *= speed_factor;
   }
 
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
-  block->steps_per_mm = steps_per_mm;
+  plan.steps_per_mm = steps_per_mm;
   uint32_t accel;
   #if ENABLED(LIN_ADVANCE)
     bool use_advance_lead = false;
@@ -2416,7 +2678,7 @@ bool Planner::_populate_block(
 
       if (use_advance_lead) {
         float e_D_ratio = (target_float.e - position_float.e) /
-          TERN(IS_KINEMATIC, block->millimeters,
+          TERN(IS_KINEMATIC, plan.millimeters,
             SQRT(sq(target_float.x - position_float.x)
                + sq(target_float.y - position_float.y)
                + sq(target_float.z - position_float.z))
@@ -2456,9 +2718,15 @@ bool Planner::_populate_block(
         LIMIT_ACCEL_FLOAT(U_AXIS, 0), LIMIT_ACCEL_FLOAT(V_AXIS, 0), LIMIT_ACCEL_FLOAT(W_AXIS, 0)
       );
     }
+
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // X and Y each take the full tangential acceleration somewhere along a curve
+      if (plan.arc_sweep)
+        NOMORE(accel, uint32_t(_MIN(settings.max_acceleration_mm_per_s2[X_AXIS], settings.max_acceleration_mm_per_s2[Y_AXIS]) * steps_per_mm));
+    #endif
   }
-  block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
+  plan.acceleration_steps_per_s2 = accel;
+  plan.acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = uint32_t(accel * (float(_BV32(24)) / (STEPPER_TIMER_RATE)));
   #endif
@@ -2468,7 +2736,7 @@ bool Planner::_populate_block(
     block->la_scaling = 0;
     if (use_advance_lead) {
       // The Bresenham algorithm will convert this step rate into extruder steps
-      block->la_advance_rate = extruder_advance_K[E_INDEX_N(extruder)] * block->acceleration_steps_per_s2;
+      block->la_advance_rate = extruder_advance_K[E_INDEX_N(extruder)] * accel;
 
       // Reduce LA ISR frequency by calling it only often enough to ensure that there will
       // never be more than four extruder steps per call
@@ -2494,9 +2762,13 @@ bool Planner::_populate_block(
   // accelerating at the current limit. Since we can only change the speed every step this is a
   // good lower limit for the entry and exit speeds. Note that for calculate_trapezoid_for_block()
   // to work correctly, this must be accurately set and propagated.
-  minimum_planner_speed_sqr = 0.5f * block->acceleration / steps_per_mm;
+  minimum_planner_speed_sqr = 0.5f * plan.acceleration / steps_per_mm;
   // Go straight to/from nominal speed if block->acceleration is too high for it.
-  NOMORE(minimum_planner_speed_sqr, sq(block->nominal_speed));
+  NOMORE(minimum_planner_speed_sqr, sq(plan.nominal_speed));
+
+  #if ENABLED(E_ONLY_FAST_PATH)
+    const bool e_only = !ANY_AXIS_MOVES(block); // Retract, prime, plunger loading, etc.
+  #endif
 
   float vmax_junction_sqr; // Initial limit on the segment entry velocity (mm/s)^2
 
@@ -2549,6 +2821,14 @@ bool Planner::_populate_block(
       #endif
     ;
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // A curved block enters along the tangent at its start
+      if (plan.arc_sweep) {
+        unit_vec.x = -plan.arc_rvec.y * plan.arc_sweep;
+        unit_vec.y =  plan.arc_rvec.x * plan.arc_sweep;
+      }
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2561,7 +2841,7 @@ bool Planner::_populate_block(
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
-    if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
+    if (moves_queued && !UNEAR_ZERO(previous_nominal_speed) && TERN1(E_ONLY_FAST_PATH, !e_only)) {
       // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
       // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
       float junction_cos_theta = LOGICAL_AXIS_GANG(
@@ -2587,7 +2867,7 @@ bool Planner::_populate_block(
         xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
         normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
+        const float junction_acceleration = limit_value_by_axis_maximum(plan.acceleration, junction_unit_vec);
 
         if (TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)) {
           TERN_(HINTS_CURVE_RADIUS, vmax_junction_sqr = junction_acceleration * hints.curve_radius);
@@ -2602,7 +2882,7 @@ bool Planner::_populate_block(
           #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
 
             // For small moves with >135° junction (octagon) find speed for approximate arc
-            if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
+            if (plan.millimeters < 1 && junction_cos_theta < -0.7071067812f) {
 
               #if ENABLED(JD_USE_MATH_ACOS)
 
@@ -2681,7 +2961,7 @@ bool Planner::_populate_block(
 
               #endif
 
-              const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
+              const float limit_sqr = (plan.millimeters * junction_acceleration) / junction_theta;
               NOMORE(vmax_junction_sqr, limit_sqr);
             }
 
@@ -2690,12 +2970,21 @@ bool Planner::_populate_block(
       }
 
       // Get the lowest speed
-      vmax_junction_sqr = _MIN(vmax_junction_sqr, sq(block->nominal_speed), sq(previous_nominal_speed));
+      vmax_junction_sqr = _MIN(vmax_junction_sqr, sq(plan.nominal_speed), sq(previous_nominal_speed));
     }
     else vmax_junction_sqr = minimum_planner_speed_sqr;
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // ...and leaves along the tangent at its end
+      if (plan.arc_sweep) {
+        const float cos_s = cos(plan.arc_sweep), sin_s = sin(plan.arc_sweep);
+        prev_unit_vec.x = unit_vec.x * cos_s - unit_vec.y * sin_s;
+        prev_unit_vec.y = unit_vec.x * sin_s + unit_vec.y * cos_s;
+      }
+    #endif
+
   #else // CLASSIC_JERK
 
     /**
@@ -2735,23 +3024,23 @@ bool Planner::_populate_block(
 
     xyze_float_t speed_diff = current_speed;
     float vmax_junction;
-    if (!moves_queued || UNEAR_ZERO(previous_nominal_speed)) {
+    if (!moves_queued || UNEAR_ZERO(previous_nominal_speed) || TERN0(E_ONLY_FAST_PATH, e_only)) {
       // Limited by a jerk to/from full halt.
-      vmax_junction = block->nominal_speed;
+      vmax_junction = plan.nominal_speed;
     }
     else {
       // Compute the maximum velocity allowed at a joint of two successive segments.
 
       // The junction velocity will be shared between successive segments. Limit the junction velocity to their minimum.
       // Scale per-axis velocities for the same vmax_junction.
-      if (block->nominal_speed < previous_nominal_speed) {
-        vmax_junction = block->nominal_speed;
+      if (plan.nominal_speed < previous_nominal_speed) {
+        vmax_junction = plan.nominal_speed;
         const float previous_scale = vmax_junction / previous_nominal_speed;
         LOOP_LOGICAL_AXES(i) speed_diff[i] -= previous_speed[i] * previous_scale;
       }
       else {
         vmax_junction = previous_nominal_speed;
-        const float current_scale = vmax_junction / block->nominal_speed;
+        const float current_scale = vmax_junction / plan.nominal_speed;
         LOOP_LOGICAL_AXES(i) speed_diff[i] = speed_diff[i] * current_scale - previous_speed[i];
       }
     }
@@ -2767,16 +3056,39 @@ bool Planner::_populate_block(
 
   #endif // CLASSIC_JERK
 
+  #if ENABLED(E_ONLY_FAST_PATH) && HAS_JUNCTION_DEVIATION
+    // MarlinBio: An E-only move doesn't join its neighbors. It starts and ends at
+    // the speed E can jump to from rest, like the junction of two orthogonal moves.
+    if (e_only) {
+      #if HAS_LINEAR_E_JERK
+        vmax_junction_sqr = sq(max_e_jerk[E_INDEX_N(extruder)]);
+      #else
+        vmax_junction_sqr = plan.acceleration * junction_deviation_mm * SQRT(0.5) / (1.0f - SQRT(0.5));
+      #endif
+      NOMORE(vmax_junction_sqr, sq(plan.nominal_speed));
+    }
+  #endif
+
+  #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+    // MarlinBio: Slow to a stop where extrusion ends so the advance of the previous block
+    // has the whole deceleration to relieve the syringe pressure. Junctions between extruding
+    // blocks keep their full speed since the advance term holds the volume per mm constant.
+    if (moves_queued && !block->la_advance_rate) {
+      block_t * const prev = &block_buffer[prev_block_index(block_buffer_head)];
+      if (prev->is_move() && prev->la_advance_rate) vmax_junction_sqr = minimum_planner_speed_sqr;
+    }
+  #endif
+
   // High acceleration limits override low jerk/junction deviation limits (as fixing trapezoids
   // or reducing acceleration introduces too much complexity and/or too much compute)
   NOLESS(vmax_junction_sqr, minimum_planner_speed_sqr);
 
   // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
+  plan.max_entry_speed_sqr = vmax_junction_sqr;
   // Set entry speed. The reverse and forward passes will optimize it later.
-  block->entry_speed_sqr = minimum_planner_speed_sqr;
+  plan.entry_speed_sqr = minimum_planner_speed_sqr;
   // Set min entry speed. Rarely it could be higher than the previous nominal speed but that's ok.
-  block->min_entry_speed_sqr = minimum_planner_speed_sqr;
+  plan.min_entry_speed_sqr = minimum_planner_speed_sqr;
   // Zero the initial_rate to indicate that calculate_trapezoid_for_block() hasn't been called yet.
   block->initial_rate = 0;
 
@@ -2784,12 +3096,57 @@ bool Planner::_populate_block(
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
-  previous_nominal_speed = block->nominal_speed;
+  previous_nominal_speed = plan.nominal_speed;
+
+  #if ENABLED(E_ONLY_FAST_PATH)
+    // An E-only move is planned once, as is. The next move starts from rest.
+    if (e_only) {
+      plan.entry_speed_sqr = plan.min_entry_speed_sqr = vmax_junction_sqr;
+      previous_nominal_speed = 0;
+    }
+  #endif
+
+  #if ENABLED(UV_EXPOSURE_HEAD)
+    // Expose moves that lay down a strand. Travel and E-only moves stay dark.
+    {
+      const bool extruding = ANY_AXIS_MOVES(block) && block->steps.e && block->direction_bits.e;
+      for (uint8_t c = 0; c < UV_EXPOSURE_CHANNELS; ++c)
+        block->uv_power[c] = extruding ? uvExposure.power_for_speed(c, plan.nominal_speed) : 0;
+    }
+  #endif
+
+  #if ENABLED(OUTPUT_EVENT_BLOCKS)
+    // A pin change waiting for travel goes into the move that covers the rest of its distance.
+    // E-only moves (retract / prime) are not travel.
+    if (pending_output_mm && ANY_AXIS_MOVES(block)) {
+      if (pending_output_mm <= plan.millimeters) {
+        block->flag.apply(BLOCK_BIT_OUTPUT);
+        block->output = pending_output;
+        block->output_step = _MAX(1UL, uint32_t(block->step_event_count * (pending_output_mm / plan.millimeters)));
+        pending_output_mm = 0;
+      }
+      else
+        pending_output_mm -= plan.millimeters;
+    }
+  #endif
+
+  #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+    // A capture due by printed path or layer rides on this move if it has no other output
+    {
+      const bool extruding = ANY_AXIS_MOVES(block) && block->steps.e && block->direction_bits.e;
+      const float at = cameraCapture.plan_move(plan.millimeters, extruding, position.z, !block->has_output());
+      if (at >= 0) {
+        block->flag.apply(BLOCK_BIT_OUTPUT);
+        block->output = CameraCapture::trigger_event();
+        block->output_step = _MAX(1UL, uint32_t(block->step_event_count * at));
+      }
+    }
+  #endif
 
   position = target;  // Update the position
 
   #if ENABLED(POWER_LOSS_RECOVERY)
-    block->sdpos = recovery.command_sdpos();
+    block->sdpos = TERN(SEGMENT_COALESCING, coalescer.command_sdpos(), recovery.command_sdpos());
     block->start_position = position_float.asLogical();
   #endif
 
@@ -2808,8 +3165,18 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  // A held move goes first
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+
+  // So does a pin change still waiting for travel, if the position or tool is about to change.
+  // Fan, mixer and other state records leave it waiting for the moves after them.
+  #if ENABLED(OUTPUT_EVENT_BLOCKS)
+    if (sync_flag == BLOCK_BIT_SYNC_POSITION || TERN0(TOOLCHANGE_SYNC_BLOCK, sync_flag == BLOCK_BIT_SYNC_TOOL))
+      flush_pending_output();
+  #endif
+
   // Wait for the next available block
-  uint8_t next_buffer_head;
+  block_index_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
   // Clear block
@@ -2823,9 +3190,25 @@ void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_PO
   #endif
 
   #if ENABLED(LASER_SYNCHRONOUS_M106_M107)
-    FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
+    FANS_LOOP(i) state_of(block).fan_speed[i] = thermalManager.fan_speed[i];
+  #endif
+
+  #if ENABLED(COMPACT_PLANNER_BLOCKS)
+    if (block->is_sync_state()) {
+      block_state_t &state = state_of(block);
+      populate_block_state(state);
+      queued_state = state;
+      queued_state_valid = true;
+    }
+  #endif
+
+  // The stepper switches to the new tool when it reaches this block
+  #if ENABLED(TOOLCHANGE_SYNC_BLOCK)
+    if (block->is_sync_tool()) block->extruder = active_extruder;
   #endif
 
+  TERN_(OUTPUT_EVENT_BLOCKS, if (block->is_sync_output()) block->output = sync_output);
+
   /**
    * M3-based power setting can be processed inline with a laser power sync block.
    * During active moves cutter.power is processed immediately, otherwise on the next move.
@@ -2847,6 +3230,39 @@ void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_PO
   stepper.wake_up();
 } // buffer_sync_block()
 
+#if ENABLED(OUTPUT_EVENT_BLOCKS)
+
+  void output_event_t::apply() const {
+    extDigitalWrite(pin, value);
+    if (pwm) hal.set_pwm_duty(pin, value);
+    TERN_(CAMERA_CAPTURE_SCHEDULER, if (capture) cameraCapture.stamp());
+  }
+
+  void Planner::flush_pending_output() {
+    if (!pending_output_mm) return;
+    pending_output_mm = 0;
+    sync_output = pending_output;
+    buffer_sync_block(BLOCK_BIT_SYNC_OUTPUT);
+  }
+
+  void Planner::buffer_output_event(const output_event_t &ev, const_float_t after_mm/*=0*/) {
+    // An earlier change still waiting for travel applies here instead
+    flush_pending_output();
+
+    if (after_mm > 0) {
+      // Measure the travel from here, not from the start of a held move
+      TERN_(SEGMENT_COALESCING, coalescer.flush());
+      pending_output = ev;
+      pending_output_mm = after_mm;
+      return;
+    }
+
+    sync_output = ev;
+    buffer_sync_block(BLOCK_BIT_SYNC_OUTPUT);
+  }
+
+#endif // OUTPUT_EVENT_BLOCKS
+
 /**
  * @brief Add a single linear movement.
  * @details Add a new linear movement to the buffer in axis units.
@@ -3097,13 +3513,16 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       return;
     }
 
-    uint8_t next_buffer_head;
+    TERN_(SEGMENT_COALESCING, coalescer.flush());
+    TERN_(COMPACT_PLANNER_BLOCKS, buffer_state_change());
+
+    block_index_t next_buffer_head;
     block_t * const block = get_next_free_block(next_buffer_head);
 
     block->flag.reset(BLOCK_BIT_PAGE);
 
-    #if HAS_FAN
-      FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
+    #if DISABLED(COMPACT_PLANNER_BLOCKS)
+      populate_block_state(block->state);
     #endif
 
     E_TERN_(block->extruder = extruder);
@@ -3151,6 +3570,9 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
 
+  // A held move ends at the old position
+  TERN_(SEGMENT_COALESCING, coalescer.flush());
+
   // When FT Motion is enabled, call synchronize() here instead of generating a sync block
   if (TERN0(FT_MOTION, ftMotion.cfg.active)) synchronize();
 
@@ -3171,7 +3593,7 @@ void Planner::set_machine_position_mm(const abce_pos_t &abce) {
     )
   );
 
-  if (has_blocks_queued()) {
+  if (has_buffered_blocks()) {
     //previous_nominal_speed = 0.0f; // Reset planner junction speeds. Assume start from rest.
     //previous_speed.reset();
     buffer_sync_block(BLOCK_BIT_SYNC_POSITION);
@@ -3214,6 +3636,7 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Special setter for planner E position (also setting E stepper position).
    */
   void Planner::set_e_position_mm(const_float_t e) {
+    TERN_(SEGMENT_COALESCING, coalescer.flush());
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -3223,7 +3646,7 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
     TERN_(HAS_POSITION_FLOAT, position_float.e = e_new);
     TERN_(IS_KINEMATIC, TERN_(HAS_EXTRUDERS, position_cart.e = e));
 
-    if (has_blocks_queued())
+    if (has_buffered_blocks())
       buffer_sync_block(BLOCK_BIT_SYNC_POSITION);
     else
       stepper.set_e_position(position.e);
@@ -3261,6 +3684,35 @@ void Planner::refresh_positioning() {
   refresh_acceleration_rates();
 }
 
+#if ENABLED(TOOL_MOTION_PROFILES)
+
+  void Planner::calc_rates(const planner_settings_t &s, planner_rates_t &r) {
+    uint32_t highest_rate = 1;
+    LOOP_DISTINCT_AXES(i) {
+      r.max_acceleration_steps_per_s2[i] = s.max_acceleration_mm_per_s2[i] * s.axis_steps_per_mm[i];
+      NOLESS(highest_rate, r.max_acceleration_steps_per_s2[i]);
+      TERN_(EDITABLE_STEPS_PER_UNIT, r.mm_per_step[i] = 1.0f / s.axis_steps_per_mm[i]);
+    }
+    r.acceleration_long_cutoff = 4294967295UL / highest_rate; // 0xFFFFFFFFUL
+    #if HAS_LINEAR_E_JERK
+      const float prop = junction_deviation_mm * SQRT(0.5) / (1.0f - SQRT(0.5));
+      for (uint8_t i = 0; i < DISTINCT_E; ++i)
+        r.max_e_jerk[i] = SQRT(prop * s.max_acceleration_mm_per_s2[E_AXIS + i]);
+    #endif
+  }
+
+  void Planner::apply_profile(const planner_settings_t &s, const planner_rates_t &r) {
+    settings = s;
+    COPY(max_acceleration_steps_per_s2, r.max_acceleration_steps_per_s2);
+    acceleration_long_cutoff = r.acceleration_long_cutoff;
+    TERN_(EDITABLE_STEPS_PER_UNIT, COPY(mm_per_step, r.mm_per_step));
+    TERN_(HAS_LINEAR_E_JERK, COPY(max_e_jerk, r.max_e_jerk));
+    // Restate the position in the new steps. With moves queued this goes in as a sync block.
+    set_position_mm(current_position);
+  }
+
+#endif // TOOL_MOTION_PROFILES
+
 // Apply limits to a variable and give a warning if the value was out of range
 inline void limit_and_warn(float &val, const AxisEnum axis, FSTR_P const setting_name, const xyze_float_t &max_limit) {
   const uint8_t lim_axis = TERN_(HAS_EXTRUDERS, axis > E_AXIS ? E_AXIS :) axis;
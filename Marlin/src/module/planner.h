@@ -79,6 +79,10 @@
   #include "../feature/direct_stepping.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "coalescer.h"
+#endif
+
 #if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
   #include "../feature/closedloop.h"
 #endif
@@ -128,6 +132,24 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // Release the syringe pressure by the end of the block
+  OPTARG(SYRINGE_CONSTANT_VOLUME, BLOCK_BIT_PRESSURE_RELEASE)
+
+  // Apply the fan / mixer / pressure state carried by the block
+  OPTARG(COMPACT_PLANNER_BLOCKS, BLOCK_BIT_SYNC_STATE)
+
+  // Switch the stepper to the tool carried by the block
+  OPTARG(TOOLCHANGE_SYNC_BLOCK, BLOCK_BIT_SYNC_TOOL)
+
+  // Apply the pin change carried by the block
+  OPTARG(OUTPUT_EVENT_BLOCKS, BLOCK_BIT_SYNC_OUTPUT)
+
+  // Apply the pin change carried by the block at its output_step
+  OPTARG(OUTPUT_EVENT_BLOCKS, BLOCK_BIT_OUTPUT)
+
+  // Number of flag bits in use
+  , BLOCK_BIT_COUNT
 };
 
 /**
@@ -135,7 +157,7 @@ enum BlockFlagBit {
  */
 typedef struct {
   union {
-    uint8_t bits;
+    bits_t(BLOCK_BIT_COUNT) bits;
 
     struct {
       bool recalculate:1;
@@ -155,6 +177,23 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+        bool pressure_release:1;
+      #endif
+
+      #if ENABLED(COMPACT_PLANNER_BLOCKS)
+        bool sync_state:1;
+      #endif
+
+      #if ENABLED(TOOLCHANGE_SYNC_BLOCK)
+        bool sync_tool:1;
+      #endif
+
+      #if ENABLED(OUTPUT_EVENT_BLOCKS)
+        bool sync_output:1;
+        bool output:1;
+      #endif
     };
   };
 
@@ -196,6 +235,72 @@ typedef struct {
 
 #endif
 
+#if ENABLED(OUTPUT_EVENT_BLOCKS)
+  /**
+   * A pin change carried through the planner and applied by the Stepper ISR
+   */
+  typedef struct {
+    pin_t pin;
+    uint8_t value;
+    bool pwm;                                 // Also set the PWM duty
+    #if ENABLED(CAMERA_CAPTURE_SCHEDULER)
+      bool capture = false;                   // Stamp a camera trigger
+    #endif
+    void apply() const;
+  } output_event_t;
+#endif
+
+/**
+ * Per-block state that rarely changes between moves
+ */
+typedef struct {
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+  #if ENABLED(MIXING_EXTRUDER)
+    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
+  #endif
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+} block_state_t;
+
+/**
+ * The fields of a block only needed by the planner (and FT Motion when loading the block).
+ * With COMPACT_PLANNER_BLOCKS these live in Planner::block_plan, apart from the ring
+ * the Stepper ISR walks, and a sync_state record keeps its payload here instead.
+ */
+typedef struct {
+
+  #if ENABLED(COMPACT_PLANNER_BLOCKS)
+    union {
+      block_state_t state;                  // Payload of a sync_state record
+      struct {
+  #endif
+
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        min_entry_speed_sqr,                // Minimum allowable junction entry speed in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration,                       // acceleration mm/sec^2
+        steps_per_mm;                       // steps/mm
+
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    float arc_sweep;                        // (rad) Signed XY sweep of a curved block. 0 for a straight block.
+    xy_float_t arc_rvec;                    // (mm) Vector from the arc center to the start of the block
+  #endif
+
+  #if ENABLED(COMPACT_PLANNER_BLOCKS)
+      };
+    };
+  #endif
+
+} block_plan_t;
+
 /**
  * struct block_t
  *
@@ -204,6 +309,12 @@ typedef struct {
  *
  * The "nominal" values are as-specified by G-code, and
  * may never actually be reached due to acceleration limits.
+ *
+ * Fields read by the Stepper ISR come first so a running block touches
+ * as few cache lines as possible. Fields only needed while the planner
+ * (re)calculates the block are in block_plan_t. With COMPACT_PLANNER_BLOCKS
+ * those are kept in a separate array and moves no longer carry block_state_t.
+ * Instead a sync_state record is queued only when that state changes.
  */
 typedef struct PlannerBlock {
 
@@ -212,18 +323,17 @@ typedef struct PlannerBlock {
   bool is_sync_pos() { return flag.sync_position; }
   bool is_sync_fan() { return TERN0(LASER_SYNCHRONOUS_M106_M107, flag.sync_fans); }
   bool is_sync_pwr() { return TERN0(LASER_POWER_SYNC, flag.sync_laser_pwr); }
-  bool is_sync() { return is_sync_pos() || is_sync_fan() || is_sync_pwr(); }
+  bool is_sync_state() { return TERN0(COMPACT_PLANNER_BLOCKS, flag.sync_state); }
+  bool is_sync_tool() { return TERN0(TOOLCHANGE_SYNC_BLOCK, flag.sync_tool); }
+  bool is_sync_output() { return TERN0(OUTPUT_EVENT_BLOCKS, flag.sync_output); }
+  bool is_sync() { return is_sync_pos() || is_sync_fan() || is_sync_pwr() || is_sync_state() || is_sync_tool() || is_sync_output(); }
+  bool has_output() { return TERN0(OUTPUT_EVENT_BLOCKS, flag.output); }
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   bool is_move() { return !(is_sync() || is_page()); }
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        min_entry_speed_sqr,                // Minimum allowable junction entry speed in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        steps_per_mm,                       // steps/mm
-        acceleration;                       // acceleration mm/sec^2
+  //
+  // Stepper ISR
+  //
 
   union {
     abce_ulong_t steps;                     // Step count along each axis
@@ -231,20 +341,22 @@ typedef struct PlannerBlock {
   };
   uint32_t step_event_count;                // The number of step events required to complete this block
 
+  AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
+
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
   #else
     static constexpr uint8_t extruder = 0;
   #endif
 
-  #if ENABLED(MIXING_EXTRUDER)
-    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
-  #endif
-
   // Settings for the trapezoid generator
   uint32_t accelerate_before,               // The index of the step event where cruising starts
            decelerate_start;                // The index of the step event on which to start decelerating
 
+  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
+           initial_rate,                    // The jerk-adjusted step rate at start of block
+           final_rate;                      // The minimal rate at exit
+
   #if ENABLED(SMOOTH_LIN_ADVANCE)
     uint32_t cruise_time;                   // Cruise time in STEP timer counts
     int32_t e_step_ratio_q30;               // Ratio of e steps to block steps.
@@ -264,8 +376,6 @@ typedef struct PlannerBlock {
     uint32_t acceleration_rate;             // Acceleration rate in (2^24 steps)/timer_ticks*s
   #endif
 
-  AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
-
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
     #if ENABLED(SMOOTH_LIN_ADVANCE)
@@ -275,28 +385,31 @@ typedef struct PlannerBlock {
       uint8_t  la_scaling;                  // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
       uint16_t max_adv_steps,               // Max advance steps to get cruising speed pressure
                final_adv_steps;             // Advance steps for exit speed pressure
+      #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+        uint32_t la_adv_comp;               // Advance steps per step event rate, 16.16 fixed point
+      #endif
     #endif
   #endif
 
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
-
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
-  #if HAS_CUTTER
-    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #if ENABLED(OUTPUT_EVENT_BLOCKS)
+    output_event_t output;                  // Pin change for a sync_output block or a move with an output
+    uint32_t output_step;                   // Step event of a move at which to apply the pin change
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
+  #if ENABLED(UV_EXPOSURE_HEAD)
+    uint8_t uv_power[UV_EXPOSURE_CHANNELS]; // UV LED power at the nominal rate, scaled by the step rate
   #endif
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
+  #if HAS_CUTTER
+    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #endif
+
+  #if ENABLED(LASER_FEATURE)
+    block_laser_t laser;
   #endif
 
   #if HAS_WIRED_LCD
@@ -308,8 +421,12 @@ typedef struct PlannerBlock {
     xyze_pos_t start_position;
   #endif
 
-  #if ENABLED(LASER_FEATURE)
-    block_laser_t laser;
+  #if DISABLED(COMPACT_PLANNER_BLOCKS)
+    block_state_t state;                    // Fan speeds, mixer color, paste pressure
+  #endif
+
+  #if DISABLED(COMPACT_PLANNER_BLOCKS)
+    block_plan_t plan;                      // Planner-only fields
   #endif
 
   void reset() { memset((char*)this, 0, sizeof(*this)); }
@@ -320,18 +437,44 @@ typedef struct PlannerBlock {
   #define HAS_POSITION_FLOAT 1
 #endif
 
-constexpr uint8_t block_dec_mod(const uint8_t v1, const uint8_t v2) {
-  return v1 >= v2 ? v1 - v2 : v1 - v2 + BLOCK_BUFFER_SIZE;
-}
+#if ENABLED(RUNTIME_BLOCK_BUFFER)
+
+  /**
+   * MarlinBio: The block pool is dimensioned from BLOCK_BUFFER_RAM_BUDGET
+   * (largest power of 2 that fits) and the live ring is a power-of-2 slice
+   * of it. The ring starts as the whole pool and M720 can shrink it down to
+   * BLOCK_BUFFER_SIZE.
+   */
+  typedef uint16_t block_index_t;
+
+  constexpr block_index_t block_pool_floor_pow2(const uint32_t n, const block_index_t p=1) {
+    return (p < 0x4000 && (uint32_t(p) << 1) <= n) ? block_pool_floor_pow2(n, p << 1) : p;
+  }
+  constexpr block_index_t block_pool_size = block_pool_floor_pow2((BLOCK_BUFFER_RAM_BUDGET) / (sizeof(block_t) + TERN0(COMPACT_PLANNER_BLOCKS, sizeof(block_plan_t))));
+  static_assert(block_pool_size >= (BLOCK_BUFFER_SIZE), "BLOCK_BUFFER_RAM_BUDGET is too small to hold BLOCK_BUFFER_SIZE blocks.");
 
-constexpr uint8_t block_inc_mod(const uint8_t v1, const uint8_t v2) {
-  return v1 + v2 < BLOCK_BUFFER_SIZE ? v1 + v2 : v1 + v2 - BLOCK_BUFFER_SIZE;
-}
+  #define BLOCK_BUFFER_COUNT Planner::block_buffer_size
+  #define BLOCK_MOD(n) ((n)&Planner::block_buffer_mask)
 
-#if IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
-  #define BLOCK_MOD(n) ((n)&((BLOCK_BUFFER_SIZE)-1))
 #else
-  #define BLOCK_MOD(n) ((n)%(BLOCK_BUFFER_SIZE))
+
+  typedef uint8_t block_index_t;
+
+  constexpr uint8_t block_dec_mod(const uint8_t v1, const uint8_t v2) {
+    return v1 >= v2 ? v1 - v2 : v1 - v2 + BLOCK_BUFFER_SIZE;
+  }
+
+  constexpr uint8_t block_inc_mod(const uint8_t v1, const uint8_t v2) {
+    return v1 + v2 < BLOCK_BUFFER_SIZE ? v1 + v2 : v1 + v2 - BLOCK_BUFFER_SIZE;
+  }
+
+  #define BLOCK_BUFFER_COUNT (BLOCK_BUFFER_SIZE)
+  #if IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
+    #define BLOCK_MOD(n) ((n)&((BLOCK_BUFFER_SIZE)-1))
+  #else
+    #define BLOCK_MOD(n) ((n)%(BLOCK_BUFFER_SIZE))
+  #endif
+
 #endif
 
 #if ENABLED(LASER_FEATURE)
@@ -381,6 +524,20 @@ typedef struct PlannerSettings {
              min_travel_feedrate_mm_s;         // (mm/s)   M205 T - Minimum travel feedrate
 } planner_settings_t;
 
+#if ENABLED(TOOL_MOTION_PROFILES)
+  // MarlinBio: Planner terms derived from planner_settings_t, kept with each tool profile
+  typedef struct {
+    uint32_t max_acceleration_steps_per_s2[DISTINCT_AXES]; // (steps/s^2)
+    uint32_t acceleration_long_cutoff;
+    #if ENABLED(EDITABLE_STEPS_PER_UNIT)
+      float mm_per_step[DISTINCT_AXES];
+    #endif
+    #if HAS_LINEAR_E_JERK
+      float max_e_jerk[DISTINCT_E];
+    #endif
+  } planner_rates_t;
+#endif
+
 #if ENABLED(IMPROVE_HOMING_RELIABILITY)
   struct motion_state_t {
     xyz_ulong_t acceleration;
@@ -407,7 +564,7 @@ typedef struct PlannerSettings {
 #endif
 
 #if ENABLED(DISABLE_OTHER_EXTRUDERS)
-  typedef uvalue_t((BLOCK_BUFFER_SIZE) * 2) last_move_t;
+  typedef uvalue_t(TERN(RUNTIME_BLOCK_BUFFER, block_pool_size, BLOCK_BUFFER_SIZE) * 2) last_move_t;
 #endif
 
 #if ENABLED(ARC_SUPPORT)
@@ -425,6 +582,10 @@ struct PlannerHints {
   #else
     static constexpr float curve_radius = 0.0;
   #endif
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    float arc_sweep = 0.0;            // (rad) Signed XY sweep of a curved move. 0 for a straight move.
+    xy_float_t arc_rvec{0};           // (mm) Vector from the arc center to the start of the move
+  #endif
   #if ENABLED(HINTS_SAFE_EXIT_SPEED)
     float safe_exit_speed_sqr = 0.0;  // Square of the speed considered "safe" at the end of the segment
                                       // i.e., at or below the exit speed of the segment that the planner
@@ -455,10 +616,34 @@ class Planner {
      *  Writer of head is Planner::buffer_segment().
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
-    static block_t block_buffer[BLOCK_BUFFER_SIZE];
-    static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
-                            block_buffer_nonbusy,   // Index of the first non busy block
-                            block_buffer_tail;      // Index of the busy block, if any
+    #if ENABLED(RUNTIME_BLOCK_BUFFER)
+      static block_t block_buffer[block_pool_size];
+      static block_index_t block_buffer_size,       // Blocks in the live ring (a power of 2)
+                           block_buffer_mask;       // block_buffer_size - 1
+    #else
+      static block_t block_buffer[BLOCK_BUFFER_SIZE];
+    #endif
+    #if ENABLED(COMPACT_PLANNER_BLOCKS)
+      static block_plan_t block_plan[TERN(RUNTIME_BLOCK_BUFFER, block_pool_size, BLOCK_BUFFER_SIZE)]; // Planner-only part of each block
+    #endif
+    static volatile block_index_t block_buffer_head,    // Index of the next block to be pushed
+                                  block_buffer_nonbusy, // Index of the first non busy block
+                                  block_buffer_tail;    // Index of the busy block, if any
+    #if ENABLED(INCREMENTAL_LOOKAHEAD)
+      static block_index_t block_buffer_planned;    // Newest block whose entry speed can no longer change
+    #endif
+
+    #if ENABLED(PLANNER_LOOKAHEAD_STATS)
+      typedef struct {
+        uint32_t insertions,                        // Calls to recalculate()
+                 touched;                           // Blocks visited by the reverse and forward passes
+        block_index_t last,                         // Blocks visited for the latest insertion
+                      peak;                         // Most blocks visited for one insertion
+        void add() { insertions++; touched += last; NOLESS(peak, last); }
+        void reset() { insertions = touched = 0; last = peak = 0; }
+      } lookahead_stats_t;
+      static lookahead_stats_t lookahead_stats;
+    #endif
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
@@ -646,6 +831,17 @@ class Planner {
      */
     static void refresh_positioning();
 
+    #if ENABLED(TOOL_MOTION_PROFILES)
+      // Derive the planner terms for the given settings without applying them
+      static void calc_rates(const planner_settings_t &s, planner_rates_t &r);
+
+      /**
+       * Swap in a tool's settings and its precomputed terms in one go.
+       * Blocks already queued keep the values they were planned with.
+       */
+      static void apply_profile(const planner_settings_t &s, const planner_rates_t &r);
+    #endif
+
     // For an axis set the Maximum Acceleration in mm/s^2
     static void set_max_acceleration(const AxisEnum axis, float inMaxAccelMMS2);
 
@@ -674,6 +870,31 @@ class Planner {
     // Manage fans, paste pressure, etc.
     static void check_axes_activity();
 
+    // Fan speeds, mixer color, etc. for a new block
+    static void populate_block_state(block_state_t &state);
+
+    #if ENABLED(COMPACT_PLANNER_BLOCKS)
+      static block_state_t tail_state;        // State applied by the last sync_state record to run
+      static block_state_t queued_state;      // State carried by the last sync_state record queued
+      static bool queued_state_valid;         // Cleared when queued records are dropped
+      static bool block_state_changed;        // Set when fans, etc. change. Cleared by the next move.
+
+      // Called by the Stepper ISR (or FT Motion) for a sync_state record
+      static void apply_block_state(block_state_t &state);
+
+      // Queue a sync_state record ahead of a new block, if needed
+      static void buffer_state_change();
+    #endif
+
+    // Called on a change to fan speeds or paste pressure, so the next move picks it up
+    FORCE_INLINE static void mark_block_state_changed() { TERN_(COMPACT_PLANNER_BLOCKS, block_state_changed = true); }
+
+    #if ENABLED(OUTPUT_EVENT_BLOCKS)
+      static output_event_t sync_output;      // Payload for the next sync_output block
+      static output_event_t pending_output;   // Pin change waiting for travel
+      static float pending_output_mm;         // Travel left before pending_output applies. 0 if none.
+    #endif
+
     // Apply fan speeds
     #if HAS_FAN
       static void sync_fan_speeds(uint8_t (&fan_speed)[FAN_COUNT]);
@@ -846,23 +1067,24 @@ class Planner {
     #endif // HAS_POSITION_MODIFIERS
 
     // Number of moves currently in the planner including the busy block, if any
-    FORCE_INLINE static uint8_t movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_tail); }
+    FORCE_INLINE static block_index_t movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_tail); }
 
     // Number of nonbusy moves currently in the planner
-    FORCE_INLINE static uint8_t nonbusy_movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_nonbusy); }
+    FORCE_INLINE static block_index_t nonbusy_movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_nonbusy); }
 
     // Remove all blocks from the buffer
     FORCE_INLINE static void clear_block_buffer() {
       block_buffer_tail = 0;
       block_buffer_head = 0;
       block_buffer_nonbusy = 0;
+      TERN_(INCREMENTAL_LOOKAHEAD, block_buffer_planned = 0);
     }
 
     // Check if movement queue is full
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
     // Get count of movement slots free
-    FORCE_INLINE static uint8_t moves_free() { return (BLOCK_BUFFER_SIZE) - 1 - movesplanned(); }
+    FORCE_INLINE static block_index_t moves_free() { return (BLOCK_BUFFER_COUNT) - 1 - movesplanned(); }
 
     /**
      * @fn Planner::get_next_free_block
@@ -872,11 +1094,14 @@ class Planner {
      *
      * @return  The first head block
      */
-    FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
+    FORCE_INLINE static block_t* get_next_free_block(block_index_t &next_buffer_head, const block_index_t count=1) {
 
       // Wait until there are enough slots free
       while (moves_free() < count) { idle(); }
 
+      // A frontier left on a consumed block must not land on the new one
+      TERN_(INCREMENTAL_LOOKAHEAD, if (block_buffer_planned == block_buffer_head) block_buffer_planned = block_buffer_tail);
+
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
       return &block_buffer[block_buffer_head];
@@ -939,6 +1164,22 @@ class Planner {
      */
     static void buffer_sync_block(const BlockFlagBit flag=BLOCK_BIT_SYNC_POSITION);
 
+    #if ENABLED(OUTPUT_EVENT_BLOCKS)
+      /**
+       * @fn Planner::buffer_output_event
+       *
+       * @brief Queue a pin change to apply in step with motion, without waiting for the planner.
+       * @details With no distance the change applies when the stepper reaches this point in the queue.
+       *          Otherwise it applies once the following moves have covered after_mm of travel.
+       *          Only one change can wait for travel. Queuing another applies the earlier one here,
+       *          as does the next sync block or synchronize() if the travel never comes.
+       *
+       * @param ev        The pin change
+       * @param after_mm  Travel (mm) after this point at which to apply the change
+       */
+      static void buffer_output_event(const output_event_t &ev, const_float_t after_mm=0);
+    #endif
+
     /**
      * @fn Planner::buffer_segment
      *
@@ -1062,10 +1303,44 @@ class Planner {
     // Called from the Temperature ISR at ~1kHz
     static void isr() { if (cleaning_buffer_counter) --cleaning_buffer_counter; }
 
+    /**
+     * Does the ring have any blocks in it?
+     */
+    FORCE_INLINE static bool has_buffered_blocks() { return (block_buffer_head != block_buffer_tail); }
+
     /**
      * Does the buffer have any blocks queued?
+     * A move held back by the segment coalescer counts as queued.
+     */
+    FORCE_INLINE static bool has_blocks_queued() {
+      return has_buffered_blocks() || TERN0(SEGMENT_COALESCING, coalescer.has_held_move());
+    }
+
+    /**
+     * The planner-only part of a block
      */
-    FORCE_INLINE static bool has_blocks_queued() { return (block_buffer_head != block_buffer_tail); }
+    FORCE_INLINE static block_plan_t& plan_of(block_t * const block) {
+      return TERN(COMPACT_PLANNER_BLOCKS, block_plan[block - block_buffer], block->plan);
+    }
+    FORCE_INLINE static const block_plan_t& plan_of(const block_t * const block) {
+      return TERN(COMPACT_PLANNER_BLOCKS, block_plan[block - block_buffer], block->plan);
+    }
+
+    /**
+     * The fan speeds, mixer color, etc. carried by a block
+     */
+    FORCE_INLINE static block_state_t& state_of(block_t * const block) {
+      return TERN(COMPACT_PLANNER_BLOCKS, plan_of(block).state, block->state);
+    }
+
+    #if ENABLED(RUNTIME_BLOCK_BUFFER)
+      /**
+       * Resize the live block ring. The size must be a power of 2 between
+       * BLOCK_BUFFER_SIZE and block_pool_size. Waits for queued moves first.
+       * Return false (leaving the ring unchanged) for any other size.
+       */
+      static bool set_block_buffer_size(const block_index_t blocks);
+    #endif
 
     /**
      * Get the current block for processing
@@ -1083,14 +1358,14 @@ class Planner {
      *
      * WARNING: Called from Stepper ISR context!
      */
-    static block_t* get_future_block(const uint8_t offset);
+    static block_t* get_future_block(const block_index_t offset);
 
     /**
      * "Release" the current block so its slot can be reused.
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void release_current_block() {
-      if (has_blocks_queued())
+      if (has_buffered_blocks())
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
@@ -1127,8 +1402,15 @@ class Planner {
     /**
      * Get the index of the next / previous block in the ring buffer
      */
-    static constexpr uint8_t next_block_index(const uint8_t block_index) { return block_inc_mod(block_index, 1); }
-    static constexpr uint8_t prev_block_index(const uint8_t block_index) { return block_dec_mod(block_index, 1); }
+    #if ENABLED(RUNTIME_BLOCK_BUFFER)
+      FORCE_INLINE static block_index_t block_dec_mod(const block_index_t v1, const block_index_t v2) { return (v1 - v2) & block_buffer_mask; }
+      FORCE_INLINE static block_index_t block_inc_mod(const block_index_t v1, const block_index_t v2) { return (v1 + v2) & block_buffer_mask; }
+      FORCE_INLINE static block_index_t next_block_index(const block_index_t block_index) { return block_inc_mod(block_index, 1); }
+      FORCE_INLINE static block_index_t prev_block_index(const block_index_t block_index) { return block_dec_mod(block_index, 1); }
+    #else
+      static constexpr uint8_t next_block_index(const uint8_t block_index) { return block_inc_mod(block_index, 1); }
+      static constexpr uint8_t prev_block_index(const uint8_t block_index) { return block_dec_mod(block_index, 1); }
+    #endif
 
     /**
      * Calculate the maximum allowable speed squared at this point, in order
@@ -1153,12 +1435,17 @@ class Planner {
     static bool reverse_pass_kernel(block_t * const current, const block_t * const next, const_float_t safe_exit_speed_sqr);
     static void forward_pass_kernel(const block_t * const previous, block_t * const current);
 
-    static void reverse_pass(const_float_t safe_exit_speed_sqr);
+    static block_index_t reverse_pass(const_float_t safe_exit_speed_sqr);
 
-    static void recalculate_trapezoids(const_float_t safe_exit_speed_sqr);
+    static void recalculate_trapezoids(const_float_t safe_exit_speed_sqr, const block_index_t start_index);
 
     static void recalculate(const_float_t safe_exit_speed_sqr);
 
+    #if ENABLED(OUTPUT_EVENT_BLOCKS)
+      // Queue the pin change waiting for travel right here
+      static void flush_pending_output();
+    #endif
+
     #if IS_KINEMATIC
       // Allow do_homing_move to access internal functions, such as buffer_segment.
       friend void do_homing_move(const AxisEnum, const float, const feedRate_t, const bool);
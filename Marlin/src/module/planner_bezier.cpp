@@ -37,10 +37,21 @@
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+  #include "curve_segmenter.h"
+#endif
+
 // See the meaning in the documentation of cubic_b_spline().
 #define MIN_STEP 0.002f
-#define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+  // MarlinBio: The Bézier tolerance replaces SIGMA, and segments may grow up to
+  // CurveSegmenter::max_segment_mm(), so allow larger steps in t.
+  #define MAX_STEP 0.25f
+  #define SIGMA curve_segmenter.settings.bezier_tolerance
+#else
+  #define MAX_STEP 0.1f
+  #define SIGMA 0.1f
+#endif
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const_float_t a, const_float_t b, const_float_t t) { return (1 - t) * a + t * b; }
@@ -155,6 +166,9 @@ void cubic_b_spline(
     }
 
     // If we did not reduce the step, maybe we should enlarge it.
+    #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+      const float max_segment_mm = curve_segmenter.max_segment_mm();
+    #endif
     if (!did_reduce) for (;;) {
       if (new_t - t > MAX_STEP) break;
       const float candidate_t = t + 2 * (new_t - t);
@@ -164,6 +178,9 @@ void cubic_b_spline(
                   interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
                   interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
       if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
+      #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+        if (dist1(bez_target.x, bez_target.y, candidate_pos0, candidate_pos1) > max_segment_mm) break;
+      #endif
       new_t = candidate_t;
       new_pos0 = candidate_pos0;
       new_pos1 = candidate_pos1;
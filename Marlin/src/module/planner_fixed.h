@@ -0,0 +1,95 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_fixed.h
+ *
+ * Integer trapezoid math for PLANNER_FIXED_POINT
+ *
+ * Step rates (steps/s) and accelerations (steps/s^2) are already integers,
+ * so ramp lengths and times can be found exactly with 64-bit intermediates.
+ * Float loses whole steps here once a squared rate passes 2^24 (~4096 steps/s),
+ * and it is slow on boards without an FPU.
+ *
+ * Rates are assumed below 2^31 so that their squares fit in an int64_t.
+ */
+
+#include <stdint.h>
+
+struct TrapezoidFixed {
+
+  // Round a signed quotient up, for d > 0
+  static int64_t div_ceil(const int64_t n, const int64_t d) { return n >= 0 ? (n + d - 1) / d : -((-n) / d); }
+
+  // Round a signed quotient half away from zero (like LROUND), for d > 0
+  static int64_t div_round(const int64_t n, const int64_t d) { return n >= 0 ? (n + d / 2) / d : -((-n + d / 2) / d); }
+
+  // Integer square root, rounded down
+  static uint32_t isqrt(uint64_t v) {
+    uint64_t r = 0, bit = uint64_t(1) << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+      if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+      else r >>= 1;
+      bit >>= 2;
+    }
+    return uint32_t(r);
+  }
+
+  static int64_t rate_sq(const uint32_t rate) { return int64_t(uint64_t(rate) * rate); }
+
+  /**
+   * Steps needed to go from one rate to another at the given acceleration,
+   * rounded up: (to² - from²) / 2a. Negative if 'to' is the lower rate.
+   */
+  static int32_t ramp_steps(const uint32_t from_rate, const uint32_t to_rate, const uint32_t accel) {
+    return int32_t(div_ceil(rate_sq(to_rate) - rate_sq(from_rate), 2 * int64_t(accel)));
+  }
+
+  /**
+   * Step where acceleration from initial_rate must end so that deceleration
+   * reaches final_rate exactly at the end of a block of 'steps' steps:
+   * (steps + (final² - initial²) / 2a) / 2, rounded.
+   */
+  static int32_t intersection_steps(const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel, const uint32_t steps) {
+    const int64_t a2 = 2 * int64_t(accel);
+    return int32_t(div_round(a2 * steps + rate_sq(final_rate) - rate_sq(initial_rate), 2 * a2));
+  }
+
+  // Rate reached after accelerating over some steps: sqrt(initial² + 2as), rounded down
+  static uint32_t reached_rate(const uint32_t initial_rate, const uint32_t accel, const uint32_t steps) {
+    return isqrt(uint64_t(rate_sq(initial_rate)) + 2 * uint64_t(accel) * steps);
+  }
+
+  // Timer ticks to go from one rate to a higher one: (to - from) * timer_rate / a, rounded down
+  static uint32_t ramp_ticks(const uint32_t from_rate, const uint32_t to_rate, const uint32_t accel, const uint32_t timer_rate) {
+    if (!accel || to_rate <= from_rate) return 0;
+    return uint32_t(uint64_t(to_rate - from_rate) * timer_rate / accel);
+  }
+
+  // Timer ticks to run some steps at a constant rate, rounded down
+  static uint32_t cruise_ticks(const uint32_t steps, const uint32_t rate, const uint32_t timer_rate) {
+    return rate ? uint32_t(uint64_t(steps) * timer_rate / rate) : 0;
+  }
+
+};
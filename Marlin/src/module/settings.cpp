@@ -129,6 +129,22 @@
   extern float other_extruder_advance_K[EXTRUDERS];
 #endif
 
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #include "../feature/syringe_flow.h"
+#endif
+
+#if ENABLED(TOOL_MOTION_PROFILES)
+  #include "../feature/tool_profiles.h"
+#endif
+
+#if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+  #include "curve_segmenter.h"
+#endif
+
+#if ENABLED(UV_EXPOSURE_HEAD)
+  #include "../feature/uv_exposure.h"
+#endif
+
 #if HAS_MULTI_EXTRUDER
   #include "tool_change.h"
   void M217_report(const bool eeprom);
@@ -504,6 +520,41 @@ typedef struct SettingsDataStruct {
     #endif
   #endif
 
+  //
+  // SYRINGE_FLOW_MODEL
+  //
+  #if ENABLED(SYRINGE_FLOW_MODEL)
+    syringe_flow_settings_t syringe_flow_settings[EXTRUDERS]; // M718 D B K
+  #endif
+
+  //
+  // TOOL_MOTION_PROFILES
+  //
+  #if ENABLED(TOOL_MOTION_PROFILES)
+    tool_profile_t tool_motion_profiles[EXTRUDERS];     // M726, M92 M201 M203 M204 M205 M900 per tool
+  #endif
+
+  //
+  // ADAPTIVE_CURVE_SEGMENTS
+  //
+  #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+    curve_segmenter_settings_t curve_segmenter_settings;      // M719 S B R
+  #endif
+
+  //
+  // RUNTIME_BLOCK_BUFFER
+  //
+  #if ENABLED(RUNTIME_BLOCK_BUFFER)
+    block_index_t planner_block_buffer_size;                  // M720 S
+  #endif
+
+  //
+  // UV_EXPOSURE_HEAD
+  //
+  #if ENABLED(UV_EXPOSURE_HEAD)
+    float uv_exposure_dose[UV_EXPOSURE_CHANNELS];             // M723 P D
+  #endif
+
   //
   // Stepper Motors Current
   //
@@ -724,6 +775,9 @@ uint16_t MarlinSettings::datasize() { return sizeof(SettingsData); }
 void MarlinSettings::postprocess() {
   xyze_pos_t oldpos = current_position;
 
+  // The active tool's profile becomes the live planner settings
+  TERN_(TOOL_MOTION_PROFILES, tool_profiles.load(active_extruder));
+
   // steps per s2 needs to be updated to agree with units per s2
   planner.refresh_acceleration_rates();
 
@@ -733,6 +787,9 @@ void MarlinSettings::postprocess() {
 
   TERN_(PIDTEMP, thermalManager.updatePID());
 
+  // Syringe K and barrel diameter override M900 and M200
+  TERN_(SYRINGE_FLOW_MODEL, syringe_flow.apply_all());
+
   #if DISABLED(NO_VOLUMETRICS)
     planner.calculate_volumetric_multipliers();
   #elif EXTRUDERS
@@ -1566,6 +1623,47 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    //
+    // Syringe Flow Model
+    //
+    #if ENABLED(SYRINGE_FLOW_MODEL)
+      _FIELD_TEST(syringe_flow_settings);
+      EEPROM_WRITE(syringe_flow.settings);
+    #endif
+
+    //
+    // Tool Motion Profiles
+    //
+    #if ENABLED(TOOL_MOTION_PROFILES)
+      tool_profiles.store(active_extruder);
+      _FIELD_TEST(tool_motion_profiles);
+      EEPROM_WRITE(tool_profiles.profile);
+    #endif
+
+    //
+    // Curve Segmentation
+    //
+    #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+      _FIELD_TEST(curve_segmenter_settings);
+      EEPROM_WRITE(curve_segmenter.settings);
+    #endif
+
+    //
+    // Planner Block Buffer
+    //
+    #if ENABLED(RUNTIME_BLOCK_BUFFER)
+      _FIELD_TEST(planner_block_buffer_size);
+      EEPROM_WRITE(planner.block_buffer_size);
+    #endif
+
+    //
+    // UV Exposure Dose
+    //
+    #if ENABLED(UV_EXPOSURE_HEAD)
+      _FIELD_TEST(uv_exposure_dose);
+      EEPROM_WRITE(uvExposure.dose);
+    #endif
+
     //
     // Motor Current PWM
     //
@@ -2653,6 +2751,70 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      //
+      // Syringe Flow Model
+      //
+      #if ENABLED(SYRINGE_FLOW_MODEL)
+      {
+        syringe_flow_settings_t syringe_flow_settings[EXTRUDERS];
+        _FIELD_TEST(syringe_flow_settings);
+        EEPROM_READ(syringe_flow_settings);
+        if (!validating) COPY(syringe_flow.settings, syringe_flow_settings);
+      }
+      #endif
+
+      //
+      // Tool Motion Profiles
+      //
+      #if ENABLED(TOOL_MOTION_PROFILES)
+      {
+        tool_profile_t tool_motion_profiles[EXTRUDERS];
+        _FIELD_TEST(tool_motion_profiles);
+        EEPROM_READ(tool_motion_profiles);
+        if (!validating) {
+          COPY(tool_profiles.profile, tool_motion_profiles);
+          tool_profiles.validate();
+        }
+      }
+      #endif
+
+      //
+      // Curve Segmentation
+      //
+      #if ENABLED(ADAPTIVE_CURVE_SEGMENTS)
+      {
+        curve_segmenter_settings_t curve_segmenter_settings;
+        _FIELD_TEST(curve_segmenter_settings);
+        EEPROM_READ(curve_segmenter_settings);
+        if (!validating) curve_segmenter.settings = curve_segmenter_settings;
+      }
+      #endif
+
+      //
+      // Planner Block Buffer
+      //
+      #if ENABLED(RUNTIME_BLOCK_BUFFER)
+      {
+        block_index_t planner_block_buffer_size;
+        _FIELD_TEST(planner_block_buffer_size);
+        EEPROM_READ(planner_block_buffer_size);
+        if (!validating && !planner.set_block_buffer_size(planner_block_buffer_size))
+          SERIAL_WARN_MSG("Bad block buffer size ", planner_block_buffer_size, " (M720 S", planner.block_buffer_size, ")");
+      }
+      #endif
+
+      //
+      // UV Exposure Dose
+      //
+      #if ENABLED(UV_EXPOSURE_HEAD)
+      {
+        float uv_exposure_dose[UV_EXPOSURE_CHANNELS];
+        _FIELD_TEST(uv_exposure_dose);
+        EEPROM_READ(uv_exposure_dose);
+        if (!validating) COPY(uvExposure.dose, uv_exposure_dose);
+      }
+      #endif
+
       //
       // Motor Current PWM
       //
@@ -3633,6 +3795,16 @@ void MarlinSettings::reset() {
     #endif
   #endif // LIN_ADVANCE
 
+  TERN_(SYRINGE_FLOW_MODEL, syringe_flow.reset());
+
+  TERN_(TOOL_MOTION_PROFILES, tool_profiles.reset());
+
+  TERN_(ADAPTIVE_CURVE_SEGMENTS, curve_segmenter.reset());
+
+  TERN_(RUNTIME_BLOCK_BUFFER, planner.set_block_buffer_size(block_pool_size));
+
+  TERN_(UV_EXPOSURE_HEAD, uvExposure.reset());
+
   //
   // Motor Current PWM
   //
@@ -4065,6 +4237,31 @@ void MarlinSettings::reset() {
     //
     TERN_(LIN_ADVANCE, gcode.M900_report(forReplay));
 
+    //
+    // Syringe Flow Model
+    //
+    TERN_(SYRINGE_FLOW_MODEL, gcode.M718_report(forReplay));
+
+    //
+    // Tool Motion Profiles
+    //
+    TERN_(TOOL_MOTION_PROFILES, gcode.M726_report(forReplay));
+
+    //
+    // Curve Segmentation
+    //
+    TERN_(ADAPTIVE_CURVE_SEGMENTS, gcode.M719_report(forReplay));
+
+    //
+    // Planner Block Buffer
+    //
+    TERN_(RUNTIME_BLOCK_BUFFER, gcode.M720_report(forReplay));
+
+    //
+    // UV Exposure Head
+    //
+    TERN_(UV_EXPOSURE_HEAD, gcode.M723_report(forReplay));
+
     //
     // Motor Current (SPI or PWM)
     //
@@ -140,6 +140,10 @@ Stepper stepper; // Singleton
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(UV_EXPOSURE_HEAD)
+  #include "../feature/uv_exposure.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../lcd/extui/ui_api.h"
 #endif
@@ -188,6 +192,17 @@ bool Stepper::abort_current_block;
   ;
 #endif
 
+#if ENABLED(Z_MULTI_ENDSTOPS)
+  uint8_t Stepper::z_separate_stopped, // = 0
+          Stepper::z_separate_latched; // = 0
+  int32_t Stepper::z_separate_steps[NUM_Z_STEPPERS] = ARRAY_N_1(NUM_Z_STEPPERS, -1);
+#endif
+
+#if ENABLED(SYRINGE_AUTO_ZERO)
+  bool Stepper::separate_e_axes; // = false
+  volatile uint8_t Stepper::e_separate_mask; // = 0
+#endif
+
 // In timer_ticks
 uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
 
@@ -298,8 +313,15 @@ uint32_t Stepper::advance_divisor = 0,
   hal_timer_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(OUTPUT_EVENT_BLOCKS)
+  uint32_t Stepper::output_event_step; // = 0
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
+  #if HAS_QS_STEP_PAGES
+    DirectStepping::qs_step_state_t Stepper::qs_state;
+  #endif
 #endif
 
 hal_timer_t Stepper::ticks_nominal = 0;
@@ -317,7 +339,19 @@ xyze_int8_t Stepper::count_direction{0};
 // MarlinBio: The below macros handle multiple steppers and endstops.
 // They've been modified to allow independent Z axes based on locks
 // set by other features.
-#define STEPTEST(A,M,I) TERN0(USE_##A##I##_##M, !(TEST(endstops.state(), A##I##_##M) && M## DIR(A)))
+// A Z motor that has been latched as stopped sits out the rest of a separate-axis move.
+#if ENABLED(Z_MULTI_ENDSTOPS)
+  #define _Z_MOTOR_BIT_  0
+  #define _Z_MOTOR_BIT_2 1
+  #define _Z_MOTOR_BIT_3 2
+  #define _Z_MOTOR_BIT_4 3
+  #define _SEPTEST_Z(I) !TEST(z_separate_stopped, _Z_MOTOR_BIT_##I)
+#else
+  #define _SEPTEST_Z(I) true
+#endif
+#define _SEPTEST_X(I) true
+#define _SEPTEST_Y(I) true
+#define STEPTEST(A,M,I) TERN0(USE_##A##I##_##M, !(TEST(endstops.state(), A##I##_##M) && M## DIR(A)) && _SEPTEST_##A(I))
 #define _STEP_WRITE(A,I,V) A##I##_STEP_WRITE(V)
 
 #define DUAL_ENDSTOP_APPLY_STEP(A,V)             \
@@ -519,6 +553,16 @@ xyze_int8_t Stepper::count_direction{0};
 
 #if ENABLED(MIXING_EXTRUDER)
   #define E_APPLY_DIR(FWD,Q) do{ if (FWD) { MIXER_STEPPER_LOOP(j) FWD_E_DIR(j); } else { MIXER_STEPPER_LOOP(j) REV_E_DIR(j); } }while(0)
+#elif ENABLED(SYRINGE_AUTO_ZERO)
+  // Plain loops, since these also expand inside the MAP used by FT Motion
+  #define E_APPLY_DIR(FWD,Q) do{ \
+    if (separate_e_axes) { for (uint8_t _e = 0; _e < E_STEPPERS; ++_e) if (TEST(e_separate_mask, _e)) { if (FWD) FWD_E_DIR(_e); else REV_E_DIR(_e); } } \
+    else if (FWD) { FWD_E_DIR(stepper_extruder); } else { REV_E_DIR(stepper_extruder); } \
+  }while(0)
+  #define E_APPLY_STEP(STATE,Q) do{ \
+    if (separate_e_axes) { for (uint8_t _e = 0; _e < E_STEPPERS; ++_e) if (TEST(e_separate_mask, _e)) E_STEP_WRITE(_e, STATE); } \
+    else E_STEP_WRITE(stepper_extruder, STATE); \
+  }while(0)
 #else
   #define E_APPLY_DIR(FWD,Q) do{ if (FWD) { FWD_E_DIR(stepper_extruder); } else { REV_E_DIR(stepper_extruder); } }while(0)
   #define E_APPLY_STEP(STATE,Q) E_STEP_WRITE(stepper_extruder, STATE)
@@ -658,6 +702,10 @@ void Stepper::disable_all_steppers() {
 #if ENABLED(FT_MOTION)
   // We'll compare the updated DIR bits to the last set state
   static AxisBits last_set_direction;
+  #if ENABLED(FTM_STEPPER_CHANNELS) && HAS_EXTRUDERS
+    // Each syringe channel keeps its own DIR state, known only while FT Motion runs
+    static uint8_t e_ch_dir, e_ch_dir_set;
+  #endif
 #endif
 
 // Set a single axis direction based on the last set flags.
@@ -690,6 +738,130 @@ void Stepper::apply_directions() {
   DIR_WAIT_AFTER();
 }
 
+#if HAS_QS_STEP_PAGES
+
+  // Set the STEP pins of the given queue-step motors
+  void Stepper::qs_write_steps(const uint16_t motors, const bool high) {
+    using namespace DirectStepping;
+    if (TEST(motors, QS_X)) X_APPLY_STEP(high ? STEP_STATE_X : !STEP_STATE_X, 0);
+    #if HAS_Y_AXIS
+      if (TEST(motors, QS_Y)) Y_APPLY_STEP(high ? STEP_STATE_Y : !STEP_STATE_Y, 0);
+    #endif
+    #if HAS_Z_AXIS
+      const bool zs = high ? STEP_STATE_Z : !STEP_STATE_Z;
+      if (TEST(motors, QS_Z)) Z_STEP_WRITE(zs);
+      #if NUM_Z_STEPPERS >= 2
+        if (TEST(motors, QS_Z2)) Z2_STEP_WRITE(zs);
+        #if NUM_Z_STEPPERS >= 3
+          if (TEST(motors, QS_Z3)) Z3_STEP_WRITE(zs);
+          #if NUM_Z_STEPPERS >= 4
+            if (TEST(motors, QS_Z4)) Z4_STEP_WRITE(zs);
+          #endif
+        #endif
+      #endif
+    #endif
+    for (uint8_t e = 0; e < E_STEPPERS; ++e)
+      if (TEST(motors, QS_E0 + e)) E_STEP_WRITE(e, high ? STEP_STATE_E : !STEP_STATE_E);
+  }
+
+  // Set the DIR pins of the given queue-step motors from their record directions
+  void Stepper::qs_write_dirs(const uint16_t motors) {
+    using namespace DirectStepping;
+    #define QS_FWD(M) !TEST(qs_state.reverse, QS_##M)
+    if (TEST(motors, QS_X)) X_APPLY_DIR(QS_FWD(X), false);
+    #if HAS_Y_AXIS
+      if (TEST(motors, QS_Y)) Y_APPLY_DIR(QS_FWD(Y), false);
+    #endif
+    #if HAS_Z_AXIS
+      if (TEST(motors, QS_Z)) Z_DIR_WRITE(QS_FWD(Z));
+      #if NUM_Z_STEPPERS >= 2
+        if (TEST(motors, QS_Z2)) Z2_DIR_WRITE(INVERT_DIR(Z2_VS_Z, QS_FWD(Z2)));
+        #if NUM_Z_STEPPERS >= 3
+          if (TEST(motors, QS_Z3)) Z3_DIR_WRITE(INVERT_DIR(Z3_VS_Z, QS_FWD(Z3)));
+          #if NUM_Z_STEPPERS >= 4
+            if (TEST(motors, QS_Z4)) Z4_DIR_WRITE(INVERT_DIR(Z4_VS_Z, QS_FWD(Z4)));
+          #endif
+        #endif
+      #endif
+    #endif
+    for (uint8_t e = 0; e < E_STEPPERS; ++e) {
+      if (!TEST(motors, QS_E0 + e)) continue;
+      if (TEST(qs_state.reverse, QS_E0 + e)) REV_E_DIR(e); else FWD_E_DIR(e);
+    }
+  }
+
+  // Load the first record of each motor in the current page and set up its DIR pin
+  void Stepper::qs_page_start() {
+    using namespace DirectStepping;
+    const uint8_t * const page = page_step_state.page;
+    const uint16_t motors = page[2] | (page[3] << 8);
+    const uint8_t *p = page + 4;
+
+    qs_state.active = qs_state.dir_pending = 0;
+    for (uint8_t i = 0; i < QS_MOTORS; ++i) {
+      if (!TEST(motors, i)) continue;
+      qs_motor_t &m = qs_state.motor[i];
+      m.left = *p++;
+      m.rec = p;
+      p += m.left * QS_RECORD_SIZE;
+      SET_BIT_TO(qs_state.reverse, i, qs_load_record(m));
+      SBI(qs_state.active, i);
+    }
+
+    // The stepper position follows X, Y, the first unlocked Z and the active E
+    uint8_t z = 0;
+    #if ANY(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
+      if (locked_Z_motor) {
+        z = 1;
+        #if NUM_Z_STEPPERS >= 3
+          if (locked_Z2_motor) {
+            z = 2;
+            #if NUM_Z_STEPPERS >= 4
+              if (locked_Z3_motor) z = 3;
+            #endif
+          }
+        #endif
+      }
+    #endif
+    qs_state.track = _BV(QS_X) | _BV(QS_Y) | _BV(QS_Z + z) | _BV(QS_E0 + stepper_extruder);
+
+    DIR_WAIT_BEFORE();
+    qs_write_dirs(qs_state.active);
+    DIR_WAIT_AFTER();
+  }
+
+  // Advance every active motor by one tick and return the motors that step on it
+  uint16_t Stepper::qs_page_tick() {
+    using namespace DirectStepping;
+    uint16_t pulse = 0;
+    for (uint8_t i = 0; i < QS_MOTORS; ++i) {
+      if (!TEST(qs_state.active, i)) continue;
+      qs_motor_t &m = qs_state.motor[i];
+      if (--m.wait) continue;
+
+      SBI(pulse, i);
+      if (TEST(qs_state.track, i)) {
+        const AxisEnum axis = i < QS_Z ? AxisEnum(i) : i < QS_E0 ? Z_AXIS : E_AXIS;
+        count_position[axis] += TEST(qs_state.reverse, i) ? -1 : 1;
+      }
+
+      m.interval += m.add;
+      m.wait = m.interval;
+      if (--m.count) continue;
+
+      // Record finished. A direction change waits until this pulse is over.
+      if (!m.left)
+        CBI(qs_state.active, i);
+      else if (qs_load_record(m) != TEST(qs_state.reverse, i)) {
+        TBI(qs_state.reverse, i);
+        SBI(qs_state.dir_pending, i);
+      }
+    }
+    return pulse;
+  }
+
+#endif // HAS_QS_STEP_PAGES
+
 #if ENABLED(S_CURVE_ACCELERATION)
   /**
    *  This uses a quintic (fifth-degree) Bézier polynomial for the velocity curve, giving
@@ -1547,6 +1719,11 @@ void Stepper::isr() {
   #if ENABLED(FT_MOTION)
     static uint32_t ftMotion_nextAuxISR = 0U;  // Storage for the next ISR of the auxilliary tasks.
     const bool using_ftMotion = ftMotion.cfg.active;
+    #if ENABLED(FTM_STEPPER_CHANNELS) && HAS_EXTRUDERS
+      // The standard stepper sets the E DIR pins too, so forget the channel states on a switch
+      static bool was_ftMotion = false;
+      if (using_ftMotion != was_ftMotion) { was_ftMotion = using_ftMotion; e_ch_dir_set = 0; }
+    #endif
   #else
     constexpr bool using_ftMotion = false;
   #endif
@@ -1759,6 +1936,7 @@ void Stepper::pulse_phase_isr() {
     abort_current_block = false;
     if (current_block) {
       discard_current_block();
+      TERN_(UV_EXPOSURE_HEAD, uvExposure.off());
       #if HAS_ZV_SHAPING
         ShapingQueue::purge();
         #if ENABLED(INPUT_SHAPING_X)
@@ -1802,6 +1980,9 @@ void Stepper::pulse_phase_isr() {
 
   do {
     AxisFlags step_needed{0};
+    #if HAS_QS_STEP_PAGES
+      uint16_t qs_pulse = 0;
+    #endif
 
     #define _APPLY_STEP(AXIS, STATE, ALWAYS) AXIS ##_APPLY_STEP(STATE, ALWAYS)
     #define _STEP_STATE(AXIS) STEP_STATE_## AXIS
@@ -1975,6 +2156,10 @@ void Stepper::pulse_phase_isr() {
 
           page_step_state.segment_idx++;
 
+        #elif STEPPER_PAGE_FORMAT == SP_QS_256
+
+          qs_pulse = qs_page_tick();
+
         #else
           #error "Unknown direct stepping page format!"
         #endif
@@ -2100,6 +2285,10 @@ void Stepper::pulse_phase_isr() {
       PULSE_START(E);
     #endif
 
+    #if HAS_QS_STEP_PAGES
+      if (qs_pulse) qs_write_steps(qs_pulse, true);
+    #endif
+
     TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
 
     // TODO: need to deal with MINIMUM_STEPPER_PULSE_NS over i2s
@@ -2117,6 +2306,14 @@ void Stepper::pulse_phase_isr() {
     #endif
     #if HAS_Z_STEP
       PULSE_STOP(Z);
+      #if ENABLED(Z_MULTI_ENDSTOPS)
+        // Stop each Z motor once it has used up its own step limit
+        if (separate_multi_axis && step_needed.z) {
+          for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i)
+            if (!TEST(z_separate_stopped, i) && z_separate_steps[i] > 0 && --z_separate_steps[i] == 0)
+              SBI(z_separate_stopped, i);
+        }
+      #endif
     #endif
     #if HAS_I_STEP
       PULSE_STOP(I);
@@ -2143,6 +2340,18 @@ void Stepper::pulse_phase_isr() {
       PULSE_STOP(E);
     #endif
 
+    #if HAS_QS_STEP_PAGES
+      if (qs_pulse) {
+        qs_write_steps(qs_pulse, false);
+        if (qs_state.dir_pending) {
+          DIR_WAIT_BEFORE();
+          qs_write_dirs(qs_state.dir_pending);
+          DIR_WAIT_AFTER();
+          qs_state.dir_pending = 0;
+        }
+      }
+    #endif
+
     #if ISR_MULTI_STEPS
       if (events_to_do) START_TIMED_PULSE();
     #endif
@@ -2429,6 +2638,15 @@ hal_timer_t Stepper::block_phase_isr() {
 
   // If there is a current block
   if (current_block) {
+
+    #if ENABLED(OUTPUT_EVENT_BLOCKS)
+      // Apply a pin change due partway through the block
+      if (output_event_step && step_events_completed >= output_event_step) {
+        output_event_step = 0;
+        current_block->output.apply();
+      }
+    #endif
+
     // If current block is finished, reset pointer and finalize state
     if (step_events_completed >= step_event_count) {
       #if ENABLED(DIRECT_STEPPING)
@@ -2439,6 +2657,8 @@ hal_timer_t Stepper::block_phase_isr() {
         #elif STEPPER_PAGE_FORMAT == SP_4x1_512 || STEPPER_PAGE_FORMAT == SP_4x2_256
           #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
             count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] * count_direction[_AXIS(AXIS)];
+        #elif STEPPER_PAGE_FORMAT == SP_QS_256
+          #define PAGE_SEGMENT_UPDATE_POS(AXIS) NOOP // Counted on each step
         #endif
 
         if (current_block->is_page()) {
@@ -2446,6 +2666,8 @@ hal_timer_t Stepper::block_phase_isr() {
           PAGE_SEGMENT_UPDATE_POS(Y);
           PAGE_SEGMENT_UPDATE_POS(Z);
           PAGE_SEGMENT_UPDATE_POS(E);
+          // Hand the DIR pins back to the planner's directions
+          TERN_(HAS_QS_STEP_PAGES, apply_directions());
         }
       #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
@@ -2476,7 +2698,12 @@ hal_timer_t Stepper::block_phase_isr() {
 
         calc_nonlinear_e(acc_step_rate << oversampling_factor);
 
-        #if HAS_ROUGH_LIN_ADVANCE
+        // MarlinBio: Scale UV exposure with the head speed
+        TERN_(UV_EXPOSURE_HEAD, uvExposure.apply_rate(current_block->uv_power, acc_step_rate, current_block->nominal_rate));
+
+        #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+          if (la_active) set_la_interval(acc_step_rate, current_block->la_advance_rate);
+        #elif HAS_ROUGH_LIN_ADVANCE
           if (la_active) {
             const uint32_t la_step_rate = la_advance_steps < current_block->max_adv_steps ? current_block->la_advance_rate : 0;
             la_interval = calc_timer_interval((acc_step_rate + la_step_rate) >> current_block->la_scaling);
@@ -2540,7 +2767,11 @@ hal_timer_t Stepper::block_phase_isr() {
 
         calc_nonlinear_e(step_rate << oversampling_factor);
 
-        #if HAS_ROUGH_LIN_ADVANCE
+        TERN_(UV_EXPOSURE_HEAD, uvExposure.apply_rate(current_block->uv_power, step_rate, current_block->nominal_rate));
+
+        #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+          if (la_active) set_la_interval(step_rate, -int32_t(current_block->la_advance_rate));
+        #elif HAS_ROUGH_LIN_ADVANCE
           if (la_active) {
             const uint32_t la_step_rate = la_advance_steps > current_block->final_adv_steps ? current_block->la_advance_rate : 0;
             if (la_step_rate != step_rate) {
@@ -2593,7 +2824,9 @@ hal_timer_t Stepper::block_phase_isr() {
 
           calc_nonlinear_e(current_block->nominal_rate << oversampling_factor);
 
-          #if HAS_ROUGH_LIN_ADVANCE
+          TERN_(UV_EXPOSURE_HEAD, uvExposure.apply_rate(current_block->uv_power, current_block->nominal_rate, current_block->nominal_rate));
+
+          #if HAS_ROUGH_LIN_ADVANCE && DISABLED(SYRINGE_CONSTANT_VOLUME)
             if (la_active)
               la_interval = calc_timer_interval(current_block->nominal_rate >> current_block->la_scaling);
           #endif
@@ -2615,6 +2848,11 @@ hal_timer_t Stepper::block_phase_isr() {
 
         // The timer interval is just the nominal value for the nominal speed
         interval = ticks_nominal;
+
+        // MarlinBio: Keep the syringe pressure on target while cruising
+        #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+          if (la_active) set_la_interval(current_block->nominal_rate, 0);
+        #endif
       }
     }
 
@@ -2664,7 +2902,22 @@ hal_timer_t Stepper::block_phase_isr() {
 
         // Set "fan speeds" for a laser module
         #if ENABLED(LASER_SYNCHRONOUS_M106_M107)
-          if (current_block->is_sync_fan()) planner.sync_fan_speeds(current_block->fan_speed);
+          if (current_block->is_sync_fan()) planner.sync_fan_speeds(planner.state_of(current_block).fan_speed);
+        #endif
+
+        // Apply a change of fans, mixer, etc.
+        #if ENABLED(COMPACT_PLANNER_BLOCKS)
+          if (current_block->is_sync_state()) planner.apply_block_state(planner.state_of(current_block));
+        #endif
+
+        // MarlinBio: Unlock only the Z axis of the new tool
+        #if ENABLED(TOOLCHANGE_SYNC_BLOCK)
+          if (current_block->is_sync_tool()) set_all_z_lock(true, current_block->extruder);
+        #endif
+
+        // MarlinBio: Set a pin queued by M42 Q, M7, etc.
+        #if ENABLED(OUTPUT_EVENT_BLOCKS)
+          if (current_block->is_sync_output()) current_block->output.apply();
         #endif
 
         // Set position
@@ -2688,6 +2941,7 @@ hal_timer_t Stepper::block_phase_isr() {
       #if ENABLED(POWER_LOSS_RECOVERY)
         recovery.info.sdpos = current_block->sdpos;
         recovery.info.current_position = current_block->start_position;
+        TERN_(POWER_LOSS_JOURNAL, recovery.block_extruder = current_block->extruder);
       #endif
 
       #if ENABLED(DIRECT_STEPPING)
@@ -2697,7 +2951,7 @@ hal_timer_t Stepper::block_phase_isr() {
           page_step_state.page = page_manager.get_page(current_block->page_idx);
           page_step_state.bd.reset();
 
-          if (DirectStepping::Config::DIRECTIONAL)
+          if (DirectStepping::Config::DIRECTIONAL || ENABLED(HAS_QS_STEP_PAGES))
             current_block->direction_bits = last_direction_bits;
 
           if (!page_step_state.page) {
@@ -2710,6 +2964,14 @@ hal_timer_t Stepper::block_phase_isr() {
       // Set flags for all moving axes, accounting for kinematics
       set_axis_moved_for_current_block();
 
+      // Z motors start each block unlatched, except those with no steps left
+      #if ENABLED(Z_MULTI_ENDSTOPS)
+        z_separate_stopped = z_separate_latched = 0;
+        if (separate_multi_axis)
+          for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i)
+            if (z_separate_steps[i] == 0) SBI(z_separate_stopped, i);
+      #endif
+
       #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
         oversampling_factor = 0;
 
@@ -2727,6 +2989,10 @@ hal_timer_t Stepper::block_phase_isr() {
       // Based on the oversampling factor, do the calculations
       step_event_count = current_block->step_event_count << oversampling_factor;
 
+      #if ENABLED(OUTPUT_EVENT_BLOCKS)
+        output_event_step = current_block->has_output() ? current_block->output_step << oversampling_factor : 0;
+      #endif
+
       // Initialize Bresenham delta errors to 1/2
       delta_error = -int32_t(step_event_count);
       TERN_(HAS_ROUGH_LIN_ADVANCE, la_delta_error = delta_error);
@@ -2774,7 +3040,9 @@ hal_timer_t Stepper::block_phase_isr() {
       accelerate_before = current_block->accelerate_before << oversampling_factor;
       decelerate_start = current_block->decelerate_start << oversampling_factor;
 
-      TERN_(MIXING_EXTRUDER, mixer.stepper_setup(current_block->b_color));
+      #if ENABLED(MIXING_EXTRUDER) && DISABLED(COMPACT_PLANNER_BLOCKS)
+        mixer.stepper_setup(current_block->state.b_color);
+      #endif
 
       E_TERN_(stepper_extruder = current_block->extruder);
 
@@ -2799,6 +3067,10 @@ hal_timer_t Stepper::block_phase_isr() {
         set_directions(current_block->direction_bits);
       }
 
+      #if HAS_QS_STEP_PAGES
+        if (current_block->is_page()) qs_page_start();
+      #endif
+
       #if ENABLED(LASER_FEATURE)
         if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {           // Planner controls the laser
           if (planner.laser_inline.status.isSyncPower)
@@ -2863,17 +3135,27 @@ hal_timer_t Stepper::block_phase_isr() {
 
       calc_nonlinear_e(current_block->initial_rate << oversampling_factor);
 
+      TERN_(UV_EXPOSURE_HEAD, uvExposure.apply_rate(current_block->uv_power, current_block->initial_rate, current_block->nominal_rate));
+
       #if ENABLED(LIN_ADVANCE)
         #if ENABLED(SMOOTH_LIN_ADVANCE)
           curr_timer_tick = 0;
         #else
-          if (la_active) {
-            const uint32_t la_step_rate = la_advance_steps < current_block->max_adv_steps ? current_block->la_advance_rate : 0;
-            la_interval = calc_timer_interval((current_block->initial_rate + la_step_rate) >> current_block->la_scaling);
-          }
+          #if ENABLED(SYRINGE_CONSTANT_VOLUME)
+            if (la_active) set_la_interval(current_block->initial_rate, current_block->la_advance_rate);
+          #else
+            if (la_active) {
+              const uint32_t la_step_rate = la_advance_steps < current_block->max_adv_steps ? current_block->la_advance_rate : 0;
+              la_interval = calc_timer_interval((current_block->initial_rate + la_step_rate) >> current_block->la_scaling);
+            }
+          #endif
         #endif
       #endif
     }
+    #if ENABLED(UV_EXPOSURE_HEAD)
+      else if (!planner.has_buffered_blocks())
+        uvExposure.off(); // The queue ran dry, so stop curing. (Not for a block still being recalculated.)
+    #endif
   } // !current_block
 
   // Return the interval to wait
@@ -2944,7 +3226,7 @@ hal_timer_t Stepper::block_phase_isr() {
     #endif // INPUT_SHAPING_E_SYNC
 
     int32_t smooth_lin_adv_lookahead(uint32_t stepper_ticks) {
-      for (uint8_t i = 0; block_t *block = planner.get_future_block(i); i++) {
+      for (block_index_t i = 0; block_t *block = planner.get_future_block(i); i++) {
         if (block->is_sync()) continue;
         if (stepper_ticks <= block->acceleration_time) {
           if (!block->use_advance_lead) return 0;
@@ -3045,7 +3327,47 @@ hal_timer_t Stepper::block_phase_isr() {
       return SMOOTH_LIN_ADV_INTERVAL;
     }
 
-  #endif // SMOOTH_LIN_ADVANCE
+  #elif ENABLED(SYRINGE_CONSTANT_VOLUME)
+
+    /**
+     * MarlinBio: Hold the syringe pressure at tau times the E rate of the current step rate,
+     * so the deposited volume per mm stays constant. The advance follows the trapezoid at the
+     * natural rate of the phase (+ accelerating, - decelerating, 0 cruising). Any error, like
+     * the pressure step at a junction between blocks of different E ratio, is made up with
+     * E-only steps at the block's advance rate, on top of the motion. A block marked for
+     * pressure release aims at no pressure by its exit rate.
+     */
+    void Stepper::set_la_interval(const uint32_t step_rate, const int32_t natural_rate) {
+      const uint32_t rate = current_block->flag.pressure_release
+        ? (step_rate > current_block->final_rate ? step_rate - current_block->final_rate : 0)
+        : step_rate;
+      const int32_t target = (uint64_t(rate) * current_block->la_adv_comp) >> 16,
+                    error = target - la_advance_steps;
+
+      int32_t la_step_rate = natural_rate;
+      if (error > 1) la_step_rate += current_block->la_advance_rate;
+      else if (error < -1) la_step_rate -= current_block->la_advance_rate;
+
+      const int32_t e_rate = int32_t(step_rate) + la_step_rate;
+      if (e_rate == 0) {
+        la_interval = LA_ADV_NEVER;
+        return;
+      }
+
+      la_interval = calc_timer_interval(uint32_t(ABS(e_rate)) >> current_block->la_scaling);
+
+      const bool forward_e = e_rate > 0;
+      if (forward_e != motor_direction(E_AXIS)) {
+        last_direction_bits.toggle(E_AXIS);
+        count_direction.e = -count_direction.e;
+        DIR_WAIT_BEFORE();
+        E_APPLY_DIR(forward_e, false);
+        TERN_(FT_MOTION, last_set_direction = last_direction_bits);
+        DIR_WAIT_AFTER();
+      }
+    }
+
+  #endif // SYRINGE_CONSTANT_VOLUME
 
   // Timer interrupt for E. LA_steps is set in the main routine
   void Stepper::advance_isr() {
@@ -3575,6 +3897,23 @@ void Stepper::report_positions() {
     #define _FTM_STEP(AXIS) TEST(command, FT_BIT_STEP_##AXIS)
     #define _FTM_DIR(AXIS) TEST(command, FT_BIT_DIR_##AXIS)
 
+    #if ENABLED(FTM_STEPPER_CHANNELS)
+      // MarlinBio: The Z and E motors step from their channels. The logical Z and E bits
+      // only keep the counts, unless Z is homing to separate endstops.
+      #define _FTM_STEP_CH(C) TEST(command, FT_BIT_STEP_CH(C))
+      #define _FTM_DIR_CH(C) TEST(command, FT_BIT_DIR_CH(C))
+      #if ANY(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
+        const bool z_channels = !separate_multi_axis;
+      #else
+        constexpr bool z_channels = true;
+      #endif
+      #define _FTM_PHYS_DIR(A) (_AXIS(A) != E_AXIS)
+      #define _FTM_PHYS_STEP(A) (_AXIS(A) != E_AXIS && (_AXIS(A) != Z_AXIS || !z_channels))
+    #else
+      #define _FTM_PHYS_DIR(A) true
+      #define _FTM_PHYS_STEP(A) true
+    #endif
+
     /**
      * Update direction bits for steppers that were stepped by this command.
      * HX, HY, HZ direction bits were set for Core kinematics
@@ -3586,7 +3925,7 @@ void Stepper::report_positions() {
 
     if (last_set_direction != last_direction_bits) {
       // Apply directions (generally applying to the entire linear move)
-      #define _FTM_APPLY_DIR(A) if (last_direction_bits.A != last_set_direction.A) \
+      #define _FTM_APPLY_DIR(A) if (last_direction_bits.A != last_set_direction.A && _FTM_PHYS_DIR(A)) \
                                   SET_STEP_DIR(A);
       LOGICAL_AXIS_MAP(_FTM_APPLY_DIR);
 
@@ -3596,10 +3935,49 @@ void Stepper::report_positions() {
       DIR_WAIT_AFTER();
     }
 
+    #if ENABLED(FTM_STEPPER_CHANNELS) && HAS_EXTRUDERS
+      {
+        // Each syringe keeps its own direction
+        bool e_dir_changed = false;
+        #define _FTM_E_CH_DIR(N) \
+          if (_FTM_STEP_CH(FTM_Z_CHANNELS + N)) { \
+            const bool fwd = _FTM_DIR_CH(FTM_Z_CHANNELS + N); \
+            if (!TEST(e_ch_dir_set, N) || TEST(e_ch_dir, N) != fwd) { \
+              if (fwd) FWD_E_DIR(N); else REV_E_DIR(N); \
+              SET_BIT_TO(e_ch_dir, N, fwd); SBI(e_ch_dir_set, N); \
+              e_dir_changed = true; \
+            } \
+          }
+        REPEAT(E_STEPPERS, _FTM_E_CH_DIR)
+        if (e_dir_changed) DIR_WAIT_AFTER();
+      }
+    #endif
+
     // Start step pulses. Edge stepping will toggle the STEP pin.
-    #define _FTM_STEP_START(A) A##_APPLY_STEP(_FTM_STEP(A), false);
+    #define _FTM_STEP_START(A) if (_FTM_PHYS_STEP(A)) A##_APPLY_STEP(_FTM_STEP(A), false);
     LOGICAL_AXIS_MAP(_FTM_STEP_START);
 
+    #if ENABLED(FTM_STEPPER_CHANNELS)
+      #define _FTM_Z_CH_STEP(N,I,V) if (_FTM_STEP_CH(N)) Z##I##_STEP_WRITE(V);
+      #if NUM_Z_STEPPERS >= 4
+        #define _FTM_Z_CH_APPLY(V) do{ _FTM_Z_CH_STEP(0, ,V) _FTM_Z_CH_STEP(1,2,V) _FTM_Z_CH_STEP(2,3,V) _FTM_Z_CH_STEP(3,4,V) }while(0)
+      #elif NUM_Z_STEPPERS == 3
+        #define _FTM_Z_CH_APPLY(V) do{ _FTM_Z_CH_STEP(0, ,V) _FTM_Z_CH_STEP(1,2,V) _FTM_Z_CH_STEP(2,3,V) }while(0)
+      #elif NUM_Z_STEPPERS == 2
+        #define _FTM_Z_CH_APPLY(V) do{ _FTM_Z_CH_STEP(0, ,V) _FTM_Z_CH_STEP(1,2,V) }while(0)
+      #else
+        #define _FTM_Z_CH_APPLY(V) _FTM_Z_CH_STEP(0, ,V)
+      #endif
+      #if ENABLED(SYRINGE_AUTO_ZERO)
+        // Syringes that made contact are stopped while zeroing
+        #define _FTM_E_CH_STEP(N,V) if (_FTM_STEP_CH(FTM_Z_CHANNELS + N) && (!separate_e_axes || TEST(e_separate_mask, N))) E##N##_STEP_WRITE(V);
+      #else
+        #define _FTM_E_CH_STEP(N,V) if (_FTM_STEP_CH(FTM_Z_CHANNELS + N)) E##N##_STEP_WRITE(V);
+      #endif
+      if (z_channels) _FTM_Z_CH_APPLY(STEP_STATE_Z);
+      REPEAT2(E_STEPPERS, _FTM_E_CH_STEP, STEP_STATE_E)
+    #endif
+
     // Apply steps via I2S
     TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
 
@@ -3627,19 +4005,42 @@ void Stepper::report_positions() {
       || (!AXIS_HAS_DEDGE(X) && _FTM_STEP(X)), || (!AXIS_HAS_DEDGE(Y) && _FTM_STEP(Y)), || (!AXIS_HAS_DEDGE(Z) && _FTM_STEP(Z)),
       || (!AXIS_HAS_DEDGE(I) && _FTM_STEP(I)), || (!AXIS_HAS_DEDGE(J) && _FTM_STEP(J)), || (!AXIS_HAS_DEDGE(K) && _FTM_STEP(K)),
       || (!AXIS_HAS_DEDGE(U) && _FTM_STEP(U)), || (!AXIS_HAS_DEDGE(V) && _FTM_STEP(V)), || (!AXIS_HAS_DEDGE(W) && _FTM_STEP(W))
-    );
+    ) TERN_(FTM_STEPPER_CHANNELS, || (command & FT_STEP_CH_BITS)); // Any channel step
 
     // Allow pulses to be registered by stepper drivers
     if (any_wait) AWAIT_HIGH_PULSE();
 
     // Stop pulses. Axes with DEDGE will do nothing, assuming STEP_STATE_* is HIGH
-    #define _FTM_STEP_STOP(AXIS) AXIS##_APPLY_STEP(!STEP_STATE_##AXIS, false);
+    #define _FTM_STEP_STOP(AXIS) if (_FTM_PHYS_STEP(AXIS)) AXIS##_APPLY_STEP(!STEP_STATE_##AXIS, false);
     LOGICAL_AXIS_MAP(_FTM_STEP_STOP);
 
+    #if ENABLED(FTM_STEPPER_CHANNELS)
+      if (z_channels) _FTM_Z_CH_APPLY(!STEP_STATE_Z);
+      REPEAT2(E_STEPPERS, _FTM_E_CH_STEP, !STEP_STATE_E)
+    #endif
+
   } // Stepper::ftMotion_stepper
 
 #endif // FT_MOTION
 
+#if ENABLED(SYRINGE_AUTO_ZERO)
+
+  /**
+   * Drop one E stepper from the separate-axis moves. The STEP pin is also set
+   * idle, in case the mask changed between the start and the end of a pulse.
+   */
+  void Stepper::stop_e_stepper(const uint8_t e) {
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+    CBI(e_separate_mask, e);
+    // An edge-stepping driver would take the write as a step
+    #define _E_STEP_IDLE(N) case N: if (!AXIS_HAS_DEDGE(E##N)) E##N##_STEP_WRITE(!STEP_STATE_E); break;
+    switch (e) { REPEAT(E_STEPPERS, _E_STEP_IDLE) }
+    if (was_on) hal.isr_on();
+  }
+
+#endif
+
 #if ENABLED(BABYSTEPPING)
 
   #define _ENABLE_AXIS(A) enable_axis(_AXIS(A))
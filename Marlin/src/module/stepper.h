@@ -300,6 +300,7 @@ class Stepper {
   friend class Max7219;
   friend class FTMotion;
   friend class MarlinSettings;
+  friend class CameraCapture;
   friend void stepperTask(void *);
 
   public:
@@ -318,6 +319,13 @@ class Stepper {
       static bool separate_multi_axis;
     #endif
 
+    // MarlinBio: Syringe auto-zero drives a set of E steppers with the same pulses,
+    // dropping each one from the set as soon as its plunger touches the piston.
+    #if ENABLED(SYRINGE_AUTO_ZERO)
+      static bool separate_e_axes;    // E pulses go to every stepper in e_separate_mask
+      static volatile uint8_t e_separate_mask; // E steppers still driven in a separate-axis move
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       #if HAS_MOTOR_CURRENT_PWM
         #ifndef PWM_MOTOR_CURRENT
@@ -402,6 +410,15 @@ class Stepper {
                   ;
     #endif
 
+    // MarlinBio: Each Z motor stops on its own endstop or StallGuard trip and stays stopped
+    // for the rest of a separate-axis move. Optional per-motor step limits let the Z homing
+    // adjustments run as one move instead of one move per motor.
+    #if ENABLED(Z_MULTI_ENDSTOPS)
+      static uint8_t z_separate_stopped;                // Bits of the Z motors halted in the current move
+      static uint8_t z_separate_latched;                // Bits of the Z motors halted by their endstop in the current move
+      static int32_t z_separate_steps[NUM_Z_STEPPERS];  // Steps left for each Z motor (-1 = no limit)
+    #endif
+
     static uint32_t acceleration_time, deceleration_time; // time measured in Stepper Timer ticks
 
     #if MULTISTEPPING_LIMIT == 1
@@ -487,8 +504,15 @@ class Stepper {
       static hal_timer_t nextBabystepISR;
     #endif
 
+    #if ENABLED(OUTPUT_EVENT_BLOCKS)
+      static uint32_t output_event_step;  // Step event at which to apply the current block's pin change
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
+      #if HAS_QS_STEP_PAGES
+        static DirectStepping::qs_step_state_t qs_state;
+      #endif
     #endif
 
     static hal_timer_t ticks_nominal;
@@ -542,6 +566,8 @@ class Stepper {
       #if ENABLED(SMOOTH_LIN_ADVANCE)
         static void set_la_interval(int32_t step_rate);
         static hal_timer_t smooth_lin_adv_isr();
+      #elif ENABLED(SYRINGE_CONSTANT_VOLUME)
+        static void set_la_interval(const uint32_t step_rate, const int32_t natural_rate);
       #endif
     #endif
 
@@ -657,6 +683,32 @@ class Stepper {
         #endif
       }
     #endif
+    #if ENABLED(Z_MULTI_ENDSTOPS)
+      // Latch Z motors as stopped until the next block begins. Only endstop hits count as hits,
+      // not motors that ran out of steps.
+      FORCE_INLINE static uint8_t latch_z_stops(const uint8_t bits) {
+        z_separate_stopped |= bits;
+        return (z_separate_latched |= bits);
+      }
+      // Limit each Z motor to a number of steps in the following separate-axis moves.
+      // Hits latched by an earlier move must not stop these moves.
+      static void set_z_separate_steps(const int32_t (&steps)[NUM_Z_STEPPERS]) {
+        hal.isr_off();
+        for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i) z_separate_steps[i] = steps[i];
+        z_separate_stopped = z_separate_latched = 0;
+        hal.isr_on();
+      }
+      static void clear_z_separate_steps() {
+        for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i) z_separate_steps[i] = -1;
+      }
+    #endif
+
+    #if ENABLED(SYRINGE_AUTO_ZERO)
+      // Drive the given E steppers together, or pass 0 to return to the active extruder
+      static void set_separate_e_axes(const uint8_t mask) { e_separate_mask = mask; separate_e_axes = !!mask; }
+      // Stop one E stepper for the rest of the separate-axis moves
+      static void stop_e_stepper(const uint8_t e);
+    #endif
 
     #if ENABLED(BABYSTEPPING)
       static void do_babystep(const AxisEnum axis, const bool direction); // perform a short step with a single stepper motor, outside of any convention
@@ -770,6 +822,14 @@ class Stepper {
       static void ftMotion_stepper();
     #endif
 
+    #if HAS_QS_STEP_PAGES
+      // Queue-step pages drive each motor's STEP and DIR pins directly
+      static void qs_page_start();
+      static uint16_t qs_page_tick();
+      static void qs_write_steps(const uint16_t motors, const bool high);
+      static void qs_write_dirs(const uint16_t motors);
+    #endif
+
 };
 
 extern Stepper stepper;
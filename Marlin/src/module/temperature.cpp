@@ -488,6 +488,7 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
     if (fan >= FAN_COUNT) return;
 
     fan_speed[fan] = speed;
+    planner.mark_block_state_changed();
 
     #if NUM_REDUNDANT_FANS
       if (fan == 0) {
@@ -519,6 +520,7 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
           FANS_LOOP(i) { saved_fan_speed[i] = fan_speed[i]; fan_speed[i] = 0; }
         else
           FANS_LOOP(i) fan_speed[i] = saved_fan_speed[i];
+        planner.mark_block_state_changed();
       }
     }
 
@@ -3619,6 +3621,7 @@ void Temperature::disable_all_heaters() {
     #if ENABLED(SINGLENOZZLE_STANDBY_FAN)
       singlenozzle_fan_speed[old_tool] = fan_speed[0];
       fan_speed[0] = singlenozzle_fan_speed[new_tool];
+      planner.mark_block_state_changed();
     #endif
     #if ENABLED(SINGLENOZZLE_STANDBY_TEMP)
       singlenozzle_temp[old_tool] = temp_hotend[0].target;
@@ -4711,6 +4714,7 @@ void Temperature::isr() {
     AutoReporter<Temperature::AutoReportTemp> Temperature::auto_reporter;
     void Temperature::AutoReportTemp::report() {
       if (wait_for_heatup) return;
+      SERIAL_REPORT_SCOPE();
       print_heater_states(active_extruder OPTARG(HAS_TEMP_REDUNDANT, ENABLED(AUTO_REPORT_REDUNDANT)));
       SERIAL_EOL();
     }
@@ -68,6 +68,14 @@
   #include "../feature/mixing.h"
 #endif
 
+#if ENABLED(SYRINGE_FLOW_MODEL)
+  #include "../feature/syringe_flow.h"
+#endif
+
+#if ENABLED(TOOL_MOTION_PROFILES)
+  #include "../feature/tool_profiles.h"
+#endif
+
 #if HAS_LEVELING
   #include "../feature/bedlevel/bedlevel.h"
 #endif
@@ -155,6 +163,21 @@ void _line_to_current(const AxisEnum fr_axis, const float fscale=1) {
 void slow_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.2f); }
 void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.5f); }
 
+#if ENABLED(TOOLCHANGE_SYNC_BLOCK)
+  // MarlinBio: Queue tool-change moves without waiting. A sync block applies the new tool in order.
+  inline void toolchange_move_to_xy(const xy_pos_t &xy, const_feedRate_t fr_mm_s) {
+    current_position.set(xy.x, xy.y);
+    line_to_current_position(fr_mm_s);
+  }
+  inline void toolchange_move_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
+    current_position.z = z;
+    line_to_current_position(fr_mm_s);
+  }
+#else
+  #define toolchange_move_to_xy do_blocking_move_to_xy
+  #define toolchange_move_to_z  do_blocking_move_to_z
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_TOOL_CHANGE)
 #include "../core/debug_out.h"
 
@@ -913,8 +936,10 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
   inline void filament_swap_cooling() {
     #if HAS_FAN && TOOLCHANGE_FS_FAN >= 0
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = toolchange_settings.fan_speed;
+      planner.mark_block_state_changed();
       gcode.dwell(SEC_TO_MS(toolchange_settings.fan_time));
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = FAN_OFF_PWM;
+      planner.mark_block_state_changed();
     #endif
   }
 
@@ -1138,7 +1163,8 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
   #elif ANY(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER)
 
-    planner.synchronize();
+    // With TOOLCHANGE_SYNC_BLOCK the moves before the tool change keep running
+    IF_DISABLED(TOOLCHANGE_SYNC_BLOCK, planner.synchronize());
 
     #if ENABLED(DUAL_X_CARRIAGE)  // Only T0 allowed if the Printer is in DXC_DUPLICATION_MODE or DXC_MIRRORED_MODE
       if (new_tool != 0 && idex_is_duplicating())
@@ -1245,7 +1271,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
         if (can_move_away && TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park)) {
           // MarlinBio: Move the current Z axis out of the way, the new axis will be moved down later.
           TERN_(HAS_SOFTWARE_ENDSTOPS, NOMORE(toolchange_settings.z_raise, soft_endstop.max.z));
-          do_blocking_move_to_z(toolchange_settings.z_raise, planner.settings.max_feedrate_mm_s[Z_AXIS] * 0.5f);
+          toolchange_move_to_z(toolchange_settings.z_raise, planner.settings.max_feedrate_mm_s[Z_AXIS] * 0.5f);
         }
       #endif
 
@@ -1319,7 +1345,14 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
         IF_DISABLED(DUAL_X_CARRIAGE, active_extruder = new_tool); // Set the new active extruder
 
         // MarlinBio: Update the Z locks so that only the Z axis for the active extruder is unlocked.
-        stepper.set_all_z_lock(true, active_extruder);
+        // With TOOLCHANGE_SYNC_BLOCK the stepper does this when the moves before it are done.
+        TERN(TOOLCHANGE_SYNC_BLOCK, planner.buffer_sync_block(BLOCK_BIT_SYNC_TOOL), stepper.set_all_z_lock(true, active_extruder));
+
+        // MarlinBio: Swap in the new tool's motion settings and precomputed rates.
+        TERN_(TOOL_MOTION_PROFILES, tool_profiles.select(old_tool, active_extruder));
+
+        // MarlinBio: Switch the planner advance to the new syringe.
+        TERN_(SYRINGE_FLOW_MODEL, syringe_flow.apply(active_extruder));
       #endif
 
       TERN_(TOOL_SENSOR, tool_sensor_disabled = false);
@@ -1381,11 +1414,11 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             #if ENABLED(TOOLCHANGE_PARK)
               if (toolchange_settings.enable_park) do_blocking_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
             #else
-              do_blocking_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS]* 0.5f);
+              toolchange_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS] * 0.5f);
 
               // If using MECHANICAL_SWITCHING extruder/nozzle, set HOTEND_OFFSET in Z axis after running EVENT_GCODE_TOOLCHANGE below.
               #if NONE(MECHANICAL_SWITCHING_EXTRUDER, MECHANICAL_SWITCHING_NOZZLE)
-                do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS] * 0.5f);
+                toolchange_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS] * 0.5f);
                 SECONDARY_AXIS_CODE(
                   do_blocking_move_to_i(destination.i, planner.settings.max_feedrate_mm_s[I_AXIS]),
                   do_blocking_move_to_j(destination.j, planner.settings.max_feedrate_mm_s[J_AXIS]),
@@ -1430,7 +1463,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       TERN_(SWITCHING_NOZZLE_TWO_SERVOS, lower_nozzle(new_tool));
     }
 
-    planner.synchronize();
+    IF_DISABLED(TOOLCHANGE_SYNC_BLOCK, planner.synchronize());
 
     #if ENABLED(EXT_SOLENOID) && DISABLED(PARKING_EXTRUDER)
       disable_all_solenoids();
@@ -1569,7 +1569,13 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Keep the reserved journal. The journal syncs its own writes.
+      constexpr uint8_t write_flags = O_CREAT | O_RDWR;
+    #else
+      constexpr uint8_t write_flags = O_CREAT | O_WRITE | O_TRUNC | O_SYNC;
+    #endif
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : write_flags))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
@@ -1579,6 +1585,7 @@ void CardReader::fileHasFinished() {
   // the file being printed, so during SD printing the file should
   // be zeroed and written instead of deleted.
   void CardReader::removeJobRecoveryFile() {
+    TERN_(POWER_LOSS_JOURNAL, recovery.close()); // Left open for the journal
     if (jobRecoverFileExists()) {
       recovery.init();
       removeFile(recovery.filename);
@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/HAL/shared/flash_records.h>
+
+#define SLOTS     16
+#define SECTIONS  4
+
+// Two sectors of record slots, held in RAM
+static flash_record_t flash[2][SLOTS];
+static bool torn[2][SLOTS];
+static uint8_t image[SECTIONS * FLASH_RECORD_SECTION];
+
+static bool read_slot(const uint8_t n, const uint16_t slot, flash_record_t &rec) {
+  rec = flash[n][slot];
+  return !torn[n][slot];
+}
+
+static void erase_all() {
+  memset(flash, 0xFF, sizeof(flash));
+  memset(torn, 0, sizeof(torn));
+}
+
+// Write a record of section s filled with the given byte
+static void put(const uint8_t n, const uint16_t slot, const uint32_t seq, const uint8_t s, const uint8_t fill, const bool last) {
+  flash_record_t &rec = flash[n][slot];
+  memset(&rec.header, 0xFF, sizeof(rec.header));
+  memset(rec.data, fill, sizeof(rec.data));
+  rec.header.magic = FLASH_RECORD_MAGIC;
+  rec.header.seq = seq;
+  rec.header.key = (FLASH_RECORD_FORMAT << 8) | s;
+  rec.header.crc = 0;
+  crc16(&rec.header.crc, rec.data, sizeof(rec.data));
+  rec.header.last = last;
+}
+
+static uint8_t section_byte(const uint8_t s) { return image[s * FLASH_RECORD_SECTION + FLASH_RECORD_SECTION - 1]; }
+
+MARLIN_TEST(flash_records, blank_log) {
+  erase_all();
+  FlashRecordLog log;
+  log.load(read_slot, SLOTS, SECTIONS, image);
+  TEST_ASSERT_EQUAL(0, log.active);
+  TEST_ASSERT_EQUAL(0, log.write_slot);
+  TEST_ASSERT_EQUAL(0, log.next_seq);
+  TEST_ASSERT_FALSE(log.erase_needed);
+  for (uint8_t s = 0; s < SECTIONS; ++s) TEST_ASSERT_EQUAL(0xFF, section_byte(s));
+}
+
+// Boot after the first save of a blank log (save number 0)
+MARLIN_TEST(flash_records, boot_after_first_save) {
+  erase_all();
+  for (uint8_t s = 0; s < SECTIONS; ++s) put(0, s, 0, s, 0x10 + s, s == SECTIONS - 1);
+
+  FlashRecordLog log;
+  log.load(read_slot, SLOTS, SECTIONS, image);
+  TEST_ASSERT_EQUAL(0, log.active);
+  TEST_ASSERT_EQUAL(SECTIONS, log.write_slot);
+  TEST_ASSERT_EQUAL(1, log.next_seq);
+  for (uint8_t s = 0; s < SECTIONS; ++s) TEST_ASSERT_EQUAL(0x10 + s, section_byte(s));
+}
+
+// A later save replaces only the sections it holds
+MARLIN_TEST(flash_records, newest_record_wins) {
+  erase_all();
+  for (uint8_t s = 0; s < SECTIONS; ++s) put(0, s, 0, s, 0x10 + s, s == SECTIONS - 1);
+  put(0, SECTIONS, 1, 2, 0x22, true);
+
+  FlashRecordLog log;
+  log.load(read_slot, SLOTS, SECTIONS, image);
+  TEST_ASSERT_EQUAL(SECTIONS + 1, log.write_slot);
+  TEST_ASSERT_EQUAL(2, log.next_seq);
+  TEST_ASSERT_EQUAL(0x10, section_byte(0));
+  TEST_ASSERT_EQUAL(0x11, section_byte(1));
+  TEST_ASSERT_EQUAL(0x22, section_byte(2));
+  TEST_ASSERT_EQUAL(0x13, section_byte(3));
+}
+
+// A save cut short by a reset is ignored as a whole
+MARLIN_TEST(flash_records, unfinished_save_is_ignored) {
+  erase_all();
+  for (uint8_t s = 0; s < SECTIONS; ++s) put(0, s, 0, s, 0x10 + s, s == SECTIONS - 1);
+  put(0, SECTIONS, 1, 0, 0x20, false);
+  put(0, SECTIONS + 1, 1, 1, 0x21, false);
+  torn[0][SECTIONS + 2] = true;
+
+  FlashRecordLog log;
+  log.load(read_slot, SLOTS, SECTIONS, image);
+  TEST_ASSERT_EQUAL(SECTIONS + 3, log.write_slot);
+  TEST_ASSERT_EQUAL(2, log.next_seq);
+  TEST_ASSERT_EQUAL(0x10, section_byte(0));
+  TEST_ASSERT_EQUAL(0x11, section_byte(1));
+}
+
+// After compaction the newest sector is used and the old one needs erasing
+MARLIN_TEST(flash_records, compacted_sector_wins) {
+  erase_all();
+  for (uint8_t s = 0; s < SECTIONS; ++s) put(0, s, 0, s, 0x10 + s, s == SECTIONS - 1);
+  for (uint8_t s = 0; s < SECTIONS; ++s) put(1, s, 1, s, 0x30 + s, s == SECTIONS - 1);
+
+  FlashRecordLog log;
+  log.load(read_slot, SLOTS, SECTIONS, image);
+  TEST_ASSERT_EQUAL(1, log.active);
+  TEST_ASSERT_EQUAL(SECTIONS, log.write_slot);
+  TEST_ASSERT_TRUE(log.erase_needed);
+  for (uint8_t s = 0; s < SECTIONS; ++s) TEST_ASSERT_EQUAL(0x30 + s, section_byte(s));
+}
@@ -0,0 +1,169 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(CANCEL_OBJECTS_SEEK)
+
+#include <src/feature/cancel_object.h>
+#include <string>
+
+// A file in memory with the reader interface of the SD card
+class TestFile {
+  const std::string data;
+  uint32_t index = 0;
+public:
+  TestFile(const char * const s) : data(s) {}
+  uint32_t getIndex() { return index; }
+  void setIndex(const uint32_t i) { index = i; }
+  bool eof() { return index >= data.size(); }
+  int16_t read(void * const buf, const uint16_t n) {
+    const uint16_t count = _MIN(uint32_t(n), uint32_t(data.size() - index));
+    memcpy(buf, data.data() + index, count);
+    index += count;
+    return count;
+  }
+};
+
+// Clear the canceled objects and any state left by passed-over moves
+static void reset_seek() {
+  cancelable.reset();
+  cancelable.seeking = cancelable.seek_held = false;
+  cancelable.early_parse("G90");
+  char cmd[MAX_CMD_SIZE];
+  cancelable.seek_state(cmd);
+}
+
+static void assert_seek_state(const char * const expected) {
+  char cmd[MAX_CMD_SIZE];
+  TEST_ASSERT_TRUE(cancelable.seek_state(cmd));
+  TEST_ASSERT_EQUAL_STRING(expected, cmd);
+  TEST_ASSERT_FALSE(cancelable.seek_state(cmd));
+}
+
+MARLIN_TEST(cancel_object, early_parse_follows_canceled_objects) {
+  reset_seek();
+  cancelable.cancel_object(1);
+
+  cancelable.early_parse("M486 S1");
+  TEST_ASSERT_TRUE(cancelable.seeking);
+  cancelable.early_parse("M486 S0");
+  TEST_ASSERT_FALSE(cancelable.seeking);
+
+  cancelable.early_parse(" M486 S1");
+  TEST_ASSERT_TRUE(cancelable.seeking);
+  cancelable.early_parse("M4860 S0");             // Not M486
+  TEST_ASSERT_TRUE(cancelable.seeking);
+  cancelable.early_parse("M486 T2");              // New object count
+  TEST_ASSERT_FALSE(cancelable.seeking);
+
+  cancelable.early_parse("M486 S40");             // Out of range
+  TEST_ASSERT_FALSE(cancelable.seeking);
+}
+
+MARLIN_TEST(cancel_object, can_seek_past_only_moves) {
+  reset_seek();
+
+  TEST_ASSERT_TRUE(cancelable.can_seek_past(""));
+  TEST_ASSERT_TRUE(cancelable.can_seek_past("  "));
+  TEST_ASSERT_TRUE(cancelable.can_seek_past("G1 X10 Y10 E1"));
+  TEST_ASSERT_TRUE(cancelable.can_seek_past("G0 Z0.4 F600"));
+  TEST_ASSERT_TRUE(cancelable.can_seek_past("G92 E0"));
+
+  TEST_ASSERT_FALSE(cancelable.can_seek_past("M106 S255"));
+  TEST_ASSERT_FALSE(cancelable.can_seek_past("G28"));
+  TEST_ASSERT_FALSE(cancelable.can_seek_past("G4 P100"));
+  TEST_ASSERT_FALSE(cancelable.can_seek_past("G92 X0"));
+  TEST_ASSERT_FALSE(cancelable.can_seek_past("G92.9 E0"));
+  TEST_ASSERT_FALSE(cancelable.can_seek_past("T1"));
+
+  assert_seek_state("M486 X10.000 Y10.000 Z0.400 E0.00000 F600.0");
+}
+
+MARLIN_TEST(cancel_object, seek_moves_stops_at_kept_lines) {
+  reset_seek();
+  cancelable.cancel_object(1);
+  cancelable.early_parse("M486 S1");
+
+  const char * const text =
+    "G1 Z0.4 F600 ; layer change\n"
+    "G1 X20 Y20 E2\n"
+    "M106 S255\n"
+    "G1 X30 Y30 E3\n";
+  TestFile file(text);
+
+  // Stop at the start of the fan command, with the state the moves left behind
+  TEST_ASSERT_TRUE(cancelable.seek_moves(file));
+  TEST_ASSERT_EQUAL(strstr(text, "M106") - text, file.getIndex());
+  assert_seek_state("M486 X20.000 Y20.000 Z0.400 E2.00000 F600.0");
+
+  // Past the fan command, the last move runs out at the end of the file
+  file.setIndex(strstr(text, "G1 X30") - text);
+  TEST_ASSERT_TRUE(cancelable.seek_moves(file));
+  TEST_ASSERT_TRUE(file.eof());
+  assert_seek_state("M486 X30.000 Y30.000 E3.00000");
+}
+
+MARLIN_TEST(cancel_object, seek_moves_adds_up_relative_moves) {
+  reset_seek();
+  cancelable.cancel_object(1);
+  cancelable.early_parse("G91");
+  cancelable.early_parse("M486 S1");
+
+  const char * const text =
+    "G1 Z0.2\n"
+    "G1 X5 E1\n"
+    "\n"
+    "G1 X5 Z0.2 E1\n"
+    "M486 S0\n"
+    "G1 X1 E1\n";
+  TestFile file(text);
+
+  TEST_ASSERT_TRUE(cancelable.seek_moves(file));
+  TEST_ASSERT_EQUAL(strstr(text, "M486") - text, file.getIndex());
+  assert_seek_state("M486 X10.000 Z0.400 E1.00000");
+}
+
+MARLIN_TEST(cancel_object, seek_moves_yields_after_the_byte_limit) {
+  reset_seek();
+  cancelable.cancel_object(1);
+  cancelable.early_parse("M486 S1");
+
+  std::string text;
+  while (text.size() < 3 * (CANCEL_OBJECTS_SEEK_BYTES)) text += "G1 X1 Y2 E3\n";
+  const uint32_t kept = text.size();
+  text += "M107\n";
+  TestFile file(text.c_str());
+
+  // Each call scans a limited number of bytes and ends at the start of a line
+  uint8_t calls = 1;
+  while (!cancelable.seek_moves(file)) {
+    TEST_ASSERT_EQUAL('G', text[file.getIndex()]);
+    TEST_ASSERT_EQUAL('\n', text[file.getIndex() - 1]);
+    ++calls;
+  }
+  TEST_ASSERT_GREATER_OR_EQUAL(3, calls);
+  TEST_ASSERT_EQUAL(kept, file.getIndex());
+  assert_seek_state("M486 X1.000 Y2.000 E3.00000");
+}
+
+#endif // CANCEL_OBJECTS_SEEK
@@ -0,0 +1,123 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/module/planner_fixed.h>
+#include <math.h>
+
+// The float trapezoid math from Planner::calculate_trapezoid_for_block()
+static int32_t float_ramp_steps(const uint32_t from_rate, const uint32_t to_rate, const uint32_t accel) {
+  return int32_t(ceilf(0.5f / accel * (float(to_rate) * to_rate - float(from_rate) * from_rate)));
+}
+
+static int32_t float_intersection_steps(const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel, const uint32_t steps) {
+  const float h = 0.5f / accel, n2 = 0.0f,
+              acc = h * (n2 - float(initial_rate) * initial_rate),
+              dec = h * (n2 - float(final_rate) * final_rate);
+  return int32_t(lroundf((steps + acc - dec) * 0.5f));
+}
+
+static uint32_t float_reached_rate(const uint32_t initial_rate, const uint32_t accel, const uint32_t steps) {
+  return uint32_t(sqrtf(float(initial_rate) * initial_rate + 2.0f * accel * steps));
+}
+
+static const uint32_t rates[] = { 1, 120, 1000, 4095, 4097, 16000, 80000, 250000 },
+                      accels[] = { 100, 3000, 50000, 400000 };
+
+MARLIN_TEST(planner_fixed, isqrt) {
+  TEST_ASSERT_EQUAL_UINT32(0, TrapezoidFixed::isqrt(0));
+  TEST_ASSERT_EQUAL_UINT32(1, TrapezoidFixed::isqrt(3));
+  TEST_ASSERT_EQUAL_UINT32(2, TrapezoidFixed::isqrt(4));
+  for (uint32_t r : rates) {
+    const uint64_t sq = uint64_t(r) * r;
+    TEST_ASSERT_EQUAL_UINT32(r, TrapezoidFixed::isqrt(sq));
+    TEST_ASSERT_EQUAL_UINT32(r, TrapezoidFixed::isqrt(sq + 2 * r));
+    TEST_ASSERT_EQUAL_UINT32(r - 1, TrapezoidFixed::isqrt(sq - 1));
+  }
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFF, TrapezoidFixed::isqrt(0xFFFFFFFFFFFFFFFFULL));
+}
+
+MARLIN_TEST(planner_fixed, rounding) {
+  TEST_ASSERT_EQUAL(3, TrapezoidFixed::div_ceil(5, 2));
+  TEST_ASSERT_EQUAL(-2, TrapezoidFixed::div_ceil(-5, 2));
+  TEST_ASSERT_EQUAL(2, TrapezoidFixed::div_ceil(4, 2));
+  TEST_ASSERT_EQUAL(3, TrapezoidFixed::div_round(5, 2));
+  TEST_ASSERT_EQUAL(-3, TrapezoidFixed::div_round(-5, 2));
+  TEST_ASSERT_EQUAL(1, TrapezoidFixed::div_round(4, 3));
+}
+
+// Ramps must match float where float is exact, and never be more than a step apart
+MARLIN_TEST(planner_fixed, ramp_steps_match_float) {
+  for (uint32_t a : accels)
+    for (uint32_t lo : rates)
+      for (uint32_t hi : rates) {
+        const int32_t q = TrapezoidFixed::ramp_steps(lo, hi, a),
+                      f = float_ramp_steps(lo, hi, a);
+        if (hi < 4096 && lo < 4096)
+          TEST_ASSERT_EQUAL_INT32(f, q);
+        else
+          TEST_ASSERT_INT32_WITHIN(1 + abs(f) / 1000000, f, q);
+
+        // Fixed point is exact: the ramp reaches the target rate and no step sooner
+        const int64_t d = int64_t(hi) * hi - int64_t(lo) * lo;
+        TEST_ASSERT_TRUE(int64_t(q) * 2 * a >= d);
+        TEST_ASSERT_TRUE(int64_t(q - 1) * 2 * a < d);
+      }
+}
+
+MARLIN_TEST(planner_fixed, intersection_matches_float) {
+  static const uint32_t lengths[] = { 1, 17, 400, 12800, 1000000 };
+  for (uint32_t a : accels)
+    for (uint32_t n : lengths)
+      for (uint32_t vi : rates)
+        for (uint32_t vf : rates) {
+          const int32_t q = TrapezoidFixed::intersection_steps(vi, vf, a, n),
+                        f = float_intersection_steps(vi, vf, a, n);
+          // Float loses precision in the v^2 / 2a terms before they cancel
+          const float v = float(_MAX(vi, vf)), float_err = v * v * 0.5f / a / 8388608.0f;
+          TEST_ASSERT_INT32_WITHIN(1 + int32_t(float_err * 2), f, q);
+
+          // Equal entry and exit rates meet in the middle, however fast
+          if (vi == vf) TEST_ASSERT_EQUAL_INT32(int32_t(n + 1) / 2, q);
+        }
+}
+
+MARLIN_TEST(planner_fixed, reached_rate_matches_float) {
+  static const uint32_t steps[] = { 0, 1, 250, 40000 };
+  for (uint32_t a : accels)
+    for (uint32_t s : steps)
+      for (uint32_t vi : rates) {
+        const uint32_t q = TrapezoidFixed::reached_rate(vi, a, s),
+                       f = float_reached_rate(vi, a, s);
+        TEST_ASSERT_UINT32_WITHIN(1 + f / 1000000, f, q);
+      }
+}
+
+MARLIN_TEST(planner_fixed, ticks) {
+  TEST_ASSERT_EQUAL_UINT32(2000000, TrapezoidFixed::ramp_ticks(0, 1000, 1000, 2000000));
+  TEST_ASSERT_EQUAL_UINT32(0, TrapezoidFixed::ramp_ticks(1000, 500, 1000, 2000000));  // Not a rise
+  TEST_ASSERT_EQUAL_UINT32(0, TrapezoidFixed::ramp_ticks(0, 1000, 0, 2000000));      // No acceleration
+  TEST_ASSERT_EQUAL_UINT32(500000, TrapezoidFixed::cruise_ticks(250, 1000, 2000000));
+  TEST_ASSERT_EQUAL_UINT32(0, TrapezoidFixed::cruise_ticks(250, 0, 2000000));
+  // Long moves at high rates don't overflow
+  TEST_ASSERT_EQUAL_UINT32(4000000000UL, TrapezoidFixed::cruise_ticks(200000000UL, 100000, 2000000));
+}